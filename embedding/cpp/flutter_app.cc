@@ -6,12 +6,41 @@
 
 #include <cassert>
 
+#include "include/flutter_external_data_stream.h"
+#include "include/flutter_memory_pressure.h"
+#include "include/flutter_memory_stats.h"
+#include "include/flutter_trace.h"
+#include "include/flutter_watchdog.h"
 #include "tizen_log.h"
 
 bool FlutterApp::OnCreate() {
+  FLUTTER_TRACE_SCOPE("FlutterApp::OnCreate");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::OnCreate");
   TizenLog::Debug("Launching a Flutter application...");
 
-  engine_ = FlutterEngine::Create(dart_entrypoint_, {}, ui_thread_policy_);
+  std::string error;
+  if (!thread_config_.Validate(error)) {
+    TizenLog::Error("Invalid thread configuration: %s", error.c_str());
+    return false;
+  }
+
+  if (watchdog_threshold_ > 0.0) {
+    watchdog_ = std::make_unique<FlutterWatchdog>(
+        watchdog_threshold_, is_watchdog_stack_dump_enabled_);
+    watchdog_->Start();
+  }
+
+  if (is_deep_pause_enabled_ && !FlutterEngineThrottler::IsSupported()) {
+    TizenLog::Warn(
+        "Engine threads are not throttled while paused since their priority "
+        "could not be restored (RLIMIT_NICE).");
+  }
+
+  if (!engine_pool_) {
+    engine_pool_ = std::make_unique<FlutterEnginePool>(
+        dart_entrypoint_, std::vector<std::string>{}, ui_thread_policy_);
+  }
+  engine_ = engine_pool_->Acquire();
   if (!engine_) {
     TizenLog::Error("Could not create a Flutter engine.");
     return false;
@@ -33,62 +62,206 @@ bool FlutterApp::OnCreate() {
   window_prop.transparent = is_window_transparent_;
   window_prop.focusable = is_window_focusable_;
   window_prop.top_level = is_top_level_;
-  window_prop.renderer_type =
-      static_cast<FlutterDesktopRendererType>(renderer_type_);
+  // The engine profile only replaces the defaults, so a renderer or pixel
+  // ratio chosen by the app is kept.
+  if (renderer_type_) {
+    window_prop.renderer_type =
+        static_cast<FlutterDesktopRendererType>(*renderer_type_);
+  } else {
+    window_prop.renderer_type =
+        engine_->GetArguments().GetRendererType().value_or(
+            FlutterDesktopRendererType::kEGL);
+  }
   window_prop.user_pixel_ratio =
       user_pixel_ratio_ < 0.0 ? 0.0 : user_pixel_ratio_;
+  if (window_prop.user_pixel_ratio == 0.0) {
+    window_prop.user_pixel_ratio =
+        engine_->GetArguments().GetPixelRatio().value_or(0.0);
+  }
   window_prop.window_handle = nullptr;
   window_prop.pointing_device_support = is_pointing_device_support;
   window_prop.floating_menu_support = is_floating_menu_support;
 
-  view_ = FlutterDesktopViewCreateFromNewWindow(window_prop,
-                                                engine_->RelinquishEngine());
+  {
+    FLUTTER_TRACE_SCOPE("FlutterDesktopViewCreateFromNewWindow");
+    view_ = FlutterDesktopViewCreateFromNewWindow(window_prop,
+                                                  engine_->RelinquishEngine());
+  }
   if (!view_) {
     TizenLog::Error("Could not launch a Flutter application.");
     return false;
   }
+  if (!thread_config_.IsEmpty()) {
+    FlutterEngineThreads::Apply(thread_config_);
+  }
+  if (app_control_coalescing_window_ > 0.0) {
+    app_control_coalescer_ = std::make_unique<FlutterAppControlCoalescer>(
+        [this](app_control_h app_control) {
+          engine_->NotifyAppControl(app_control);
+        },
+        app_control_coalescing_window_, engine_->GetMessenger());
+  }
+  if (is_frame_stats_enabled_) {
+    frame_stats_ = std::make_unique<FlutterFrameStats>(engine_->GetMessenger());
+    frame_stats_->SetLogInterval(frame_stats_log_interval_);
+  }
+  if (page_cache_) {
+    page_cache_->ScheduleRecording(FlutterPageCache::kRecordingDelaySeconds);
+  }
+  if (launch_timer_) {
+    launch_timer_->MarkCreated();
+  }
   return true;
 }
 
 void FlutterApp::OnResume() {
+  FLUTTER_TRACE_SCOPE("FlutterApp::OnResume");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::OnResume");
   assert(IsRunning());
-  engine_->NotifyAppIsResumed();
+  if (is_deep_paused_) {
+    is_deep_paused_ = false;
+    throttler_.Restore();
+    FlutterExternalDataStream::SetPaused(false);
+    if (frame_stats_) {
+      frame_stats_->SetLogInterval(frame_stats_log_interval_);
+    }
+    if (has_pending_locale_change_) {
+      has_pending_locale_change_ = false;
+      for (FlutterEngine *engine : GetEngines()) {
+        engine->NotifyLocaleChange();
+      }
+    }
+  }
+  for (FlutterEngine *engine : GetEngines()) {
+    engine->NotifyAppIsResumed();
+  }
+  if (frame_stats_) {
+    frame_stats_->StartSegment();
+  }
+  if (launch_timer_) {
+    launch_timer_->Finish();
+  }
 }
 
 void FlutterApp::OnPause() {
+  FLUTTER_TRACE_SCOPE("FlutterApp::OnPause");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::OnPause");
   assert(IsRunning());
-  engine_->NotifyAppIsPaused();
+  for (FlutterEngine *engine : GetEngines()) {
+    engine->NotifyAppIsPaused();
+  }
+  if (is_deep_pause_enabled_) {
+    is_deep_paused_ = true;
+    if (frame_stats_) {
+      frame_stats_->SetLogInterval(0.0);
+    }
+    FlutterExternalDataStream::SetPaused(true);
+    throttler_.Throttle(paused_thread_nice_value_);
+  }
 }
 
 void FlutterApp::OnTerminate() {
+  FLUTTER_TRACE_SCOPE("FlutterApp::OnTerminate");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::OnTerminate");
   assert(IsRunning());
+  if (is_deep_paused_) {
+    // Locale changes are of no use to an app being terminated.
+    is_deep_paused_ = false;
+    has_pending_locale_change_ = false;
+    FlutterExternalDataStream::SetPaused(false);
+  }
+  if (app_control_coalescer_) {
+    app_control_coalescer_->Flush();
+    app_control_coalescer_ = nullptr;
+  }
+  while (!additional_views_.empty()) {
+    RemoveView(additional_views_.begin()->first);
+  }
+  if (frame_stats_) {
+    frame_stats_->LogSummary(FlutterFrameStats::Segment::kLifetime);
+    frame_stats_ = nullptr;
+  }
   engine_->NotifyAppIsDetached();
   FlutterDesktopViewDestroy(view_);
+  engine_pool_->Clear();
   engine_ = nullptr;
   view_ = nullptr;
+  watchdog_ = nullptr;
+  page_cache_ = nullptr;
 }
 
 void FlutterApp::OnAppControlReceived(app_control_h app_control) {
+  FLUTTER_TRACE_SCOPE("FlutterApp::OnAppControlReceived");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::OnAppControlReceived");
   assert(IsRunning());
-  engine_->NotifyAppControl(app_control);
+  if (app_control_coalescer_) {
+    app_control_coalescer_->Add(app_control);
+  } else {
+    engine_->NotifyAppControl(app_control);
+  }
 }
 
 void FlutterApp::OnLowMemory(app_event_info_h event_info) {
+  FLUTTER_TRACE_SCOPE("FlutterApp::OnLowMemory");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::OnLowMemory");
   assert(IsRunning());
-  engine_->NotifyLowMemoryWarning();
+  FlutterMemoryPressureLevel level =
+      FlutterMemoryPressure::GetLevel(event_info);
+  if (level == FlutterMemoryPressureLevel::kHard) {
+    std::vector<int> view_ids;
+    for (const auto &[view_id, entry] : additional_views_) {
+      if (ShouldReleaseViewOnLowMemory(view_id)) {
+        view_ids.push_back(view_id);
+      }
+    }
+    for (int view_id : view_ids) {
+      TizenLog::Info("Releasing view %d (hard memory pressure).", view_id);
+      RemoveView(view_id);
+    }
+  }
+  FlutterMemoryPressure::Reclaim(level, GetEngines(), engine_pool_.get());
+  // Sampling takes a few milliseconds, so it is done after reclaiming and
+  // only if the result can be logged.
+  if constexpr (TIZEN_LOG_MIN_PRIORITY <= DLOG_INFO) {
+    if (FlutterMemoryStats *stats = engine_->GetMemoryStats()) {
+      FlutterMemoryStats::Log(stats->Record());
+    }
+  }
 }
 
 void FlutterApp::OnLanguageChanged(app_event_info_h event_info) {
+  FLUTTER_TRACE_SCOPE("FlutterApp::OnLanguageChanged");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::OnLanguageChanged");
   assert(IsRunning());
-  engine_->NotifyLocaleChange();
+  if (is_deep_paused_) {
+    has_pending_locale_change_ = true;
+    return;
+  }
+  for (FlutterEngine *engine : GetEngines()) {
+    engine->NotifyLocaleChange();
+  }
 }
 
 void FlutterApp::OnRegionFormatChanged(app_event_info_h event_info) {
+  FLUTTER_TRACE_SCOPE("FlutterApp::OnRegionFormatChanged");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::OnRegionFormatChanged");
   assert(IsRunning());
-  engine_->NotifyLocaleChange();
+  if (is_deep_paused_) {
+    has_pending_locale_change_ = true;
+    return;
+  }
+  for (FlutterEngine *engine : GetEngines()) {
+    engine->NotifyLocaleChange();
+  }
 }
 
 int FlutterApp::Run(int argc, char **argv) {
+  FLUTTER_TRACE_INSTANT("FlutterApp::Run");
+  if (is_launch_timer_enabled_) {
+    launch_timer_ = std::make_unique<FlutterLaunchTimer>();
+    launch_timer_->Start(argc, argv);
+  }
+
   ui_app_lifecycle_callback_s lifecycle_cb = {};
   lifecycle_cb.create = [](void *data) -> bool {
     auto *app = reinterpret_cast<FlutterApp *>(data);
@@ -122,6 +295,9 @@ int FlutterApp::Run(int argc, char **argv) {
   ui_app_add_event_handler(
       &handler, APP_EVENT_LOW_BATTERY,
       [](app_event_info_h e, void *data) {
+        // Marked here since subclasses override the handler.
+        FLUTTER_TRACE_SCOPE("FlutterApp::OnLowBattery");
+        FlutterWatchdog::ScopedActivity activity("FlutterApp::OnLowBattery");
         auto *app = reinterpret_cast<FlutterApp *>(data);
         app->OnLowBattery(e);
       },
@@ -143,11 +319,27 @@ int FlutterApp::Run(int argc, char **argv) {
   ui_app_add_event_handler(
       &handler, APP_EVENT_DEVICE_ORIENTATION_CHANGED,
       [](app_event_info_h e, void *data) {
+        // Marked here since subclasses override the handler.
+        FLUTTER_TRACE_SCOPE("FlutterApp::OnDeviceOrientationChanged");
+        FlutterWatchdog::ScopedActivity activity(
+            "FlutterApp::OnDeviceOrientationChanged");
         auto *app = reinterpret_cast<FlutterApp *>(data);
         app->OnDeviceOrientationChanged(e);
       },
       this);
 
+  if (is_page_cache_warming_enabled_) {
+    page_cache_ = std::make_unique<FlutterPageCache>(
+        FlutterPageCache::GetDefaultProfilePath());
+    page_cache_->StartWarming();
+  }
+
+  if (is_engine_preload_enabled_) {
+    engine_pool_ = std::make_unique<FlutterEnginePool>(
+        dart_entrypoint_, std::vector<std::string>{}, ui_thread_policy_);
+    engine_pool_->PreloadArguments();
+  }
+
   int ret = ui_app_main(argc, argv, &lifecycle_cb, this);
   if (ret != APP_ERROR_NONE) {
     TizenLog::Error("Could not launch an application. (%d)", ret);
@@ -162,3 +354,62 @@ FlutterDesktopPluginRegistrarRef FlutterApp::GetRegistrarForPlugin(
   }
   return nullptr;
 }
+
+int FlutterApp::AddView(const FlutterDesktopWindowProperties &window_prop,
+                        const std::string &dart_entrypoint,
+                        const std::vector<std::string> &dart_entrypoint_args) {
+  FLUTTER_TRACE_SCOPE("FlutterApp::AddView");
+  FlutterWatchdog::ScopedActivity activity("FlutterApp::AddView");
+  assert(IsRunning());
+
+  AdditionalView entry;
+  entry.engine = engine_pool_->Acquire(dart_entrypoint, dart_entrypoint_args);
+  if (!entry.engine) {
+    TizenLog::Error("Could not create a Flutter engine.");
+    return -1;
+  }
+  entry.view = FlutterDesktopViewCreateFromNewWindow(
+      window_prop, entry.engine->RelinquishEngine());
+  if (!entry.view) {
+    TizenLog::Error("Could not create a Flutter view.");
+    return -1;
+  }
+  if (!thread_config_.IsEmpty()) {
+    // Apply the settings to the threads of the new engine.
+    FlutterEngineThreads::Apply(thread_config_);
+  }
+
+  int view_id = next_view_id_++;
+  additional_views_[view_id] = std::move(entry);
+  return view_id;
+}
+
+void FlutterApp::RemoveView(int view_id) {
+  auto it = additional_views_.find(view_id);
+  if (it == additional_views_.end()) {
+    TizenLog::Warn("No view found with ID %d.", view_id);
+    return;
+  }
+  it->second.engine->NotifyAppIsDetached();
+  FlutterDesktopViewDestroy(it->second.view);
+  additional_views_.erase(it);
+}
+
+FlutterEngine *FlutterApp::GetEngine(int view_id) {
+  if (view_id == 0) {
+    return engine_.get();
+  }
+  auto it = additional_views_.find(view_id);
+  if (it != additional_views_.end()) {
+    return it->second.engine.get();
+  }
+  return nullptr;
+}
+
+std::vector<FlutterEngine *> FlutterApp::GetEngines() {
+  std::vector<FlutterEngine *> engines = {engine_.get()};
+  for (auto &[view_id, entry] : additional_views_) {
+    engines.push_back(entry.engine.get());
+  }
+  return engines;
+}
@@ -0,0 +1,267 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_app_control_coalescer.h"
+
+#include <cstdlib>
+#include <map>
+
+#include "tizen_log.h"
+
+namespace {
+
+constexpr char kChannel[] = "tizen/app_control_ack";
+
+// The live coalescers by ID, so that replies arriving after a coalescer is
+// destroyed are ignored.
+std::map<uintptr_t, FlutterAppControlCoalescer *> g_coalescers;
+uintptr_t g_next_id = 1;
+
+// Appends |value| to |key| and frees it. Values are terminated by '\0',
+// which cannot appear in the values themselves.
+void AppendValue(std::string &key, char *value) {
+  if (value) {
+    key += value;
+    free(value);
+  }
+  key += '\0';
+}
+
+// Returns the extra data of |app_control| as a sorted map, with the
+// elements of arrays separated by '\0'.
+std::map<std::string, std::string> GetExtraData(app_control_h app_control) {
+  std::map<std::string, std::string> extra_data;
+  app_control_foreach_extra_data(
+      app_control,
+      [](app_control_h app_control, const char *key, void *user_data) {
+        auto *extra_data =
+            static_cast<std::map<std::string, std::string> *>(user_data);
+        std::string &entry = (*extra_data)[key];
+        bool is_array = false;
+        app_control_is_extra_data_array(app_control, key, &is_array);
+        if (is_array) {
+          char **values = nullptr;
+          int length = 0;
+          app_control_get_extra_data_array(app_control, key, &values,
+                                           &length);
+          entry += '[';
+          for (int i = 0; i < length; i++) {
+            AppendValue(entry, values[i]);
+          }
+          free(values);
+        } else {
+          char *value = nullptr;
+          app_control_get_extra_data(app_control, key, &value);
+          AppendValue(entry, value);
+        }
+        return true;
+      },
+      &extra_data);
+  return extra_data;
+}
+
+// Returns a key identifying app controls with the same operation, URI, MIME
+// type and extra data.
+std::string GetKey(app_control_h app_control) {
+  std::string key;
+  char *value = nullptr;
+  app_control_get_operation(app_control, &value);
+  AppendValue(key, value);
+  value = nullptr;
+  app_control_get_uri(app_control, &value);
+  AppendValue(key, value);
+  value = nullptr;
+  app_control_get_mime(app_control, &value);
+  AppendValue(key, value);
+  for (const auto &[name, data] : GetExtraData(app_control)) {
+    key += name;
+    key += '\0';
+    key += std::to_string(data.size());
+    key += '\0';
+    key += data;
+  }
+  return key;
+}
+
+// Returns the operation of |app_control| for logs.
+std::string GetOperation(app_control_h app_control) {
+  std::string operation;
+  char *value = nullptr;
+  if (app_control_get_operation(app_control, &value) ==
+          APP_CONTROL_ERROR_NONE &&
+      value) {
+    operation = value;
+    free(value);
+  }
+  return operation;
+}
+
+}  // namespace
+
+FlutterAppControlCoalescer::FlutterAppControlCoalescer(
+    DeliverCallback deliver, double window_seconds,
+    FlutterDesktopMessengerRef messenger, size_t max_pending)
+    : deliver_(std::move(deliver)),
+      window_seconds_(window_seconds),
+      messenger_(messenger),
+      max_pending_(max_pending > 0 ? max_pending : 1),
+      id_(g_next_id++) {
+  g_coalescers[id_] = this;
+  if (messenger_) {
+    FlutterDesktopMessengerAddRef(messenger_);
+    FlutterDesktopMessengerSetCallback(messenger_, kChannel, OnMessage, this);
+  }
+}
+
+FlutterAppControlCoalescer::~FlutterAppControlCoalescer() {
+  g_coalescers.erase(id_);
+  if (messenger_) {
+    FlutterDesktopMessengerLock(messenger_);
+    if (FlutterDesktopMessengerIsAvailable(messenger_)) {
+      FlutterDesktopMessengerSetCallback(messenger_, kChannel, nullptr,
+                                         nullptr);
+    }
+    FlutterDesktopMessengerUnlock(messenger_);
+    FlutterDesktopMessengerRelease(messenger_);
+  }
+  if (timer_) {
+    ecore_timer_del(timer_);
+  }
+  for (PendingAppControl &pending : pending_) {
+    app_control_destroy(pending.app_control);
+  }
+}
+
+void FlutterAppControlCoalescer::Add(app_control_h app_control) {
+  stats_.received++;
+  bool is_reply_requested = false;
+  app_control_is_reply_requested(app_control, &is_reply_requested);
+  if (is_reply_requested) {
+    // The sender is waiting for a reply, so this app control must reach the
+    // app. Deliver it at once, after the ones received before it.
+    Flush();
+    Deliver(app_control);
+    RequestAck();
+    return;
+  }
+  if (!timer_ && !IsAwaitingAck()) {
+    // Not in a burst. Deliver right away and start a new window.
+    Deliver(app_control);
+    RequestAck();
+    timer_ = ecore_timer_add(window_seconds_, OnWindowEnd, this);
+    return;
+  }
+
+  app_control_h clone = nullptr;
+  if (app_control_clone(&clone, app_control) != APP_CONTROL_ERROR_NONE) {
+    TizenLog::Error("Could not clone an app control.");
+    Deliver(app_control);
+    RequestAck();
+    return;
+  }
+  std::string key = GetKey(clone);
+  for (auto it = pending_.begin(); it != pending_.end(); ++it) {
+    if (it->key == key) {
+      // The merged app control takes the place of the latest copy, after
+      // any app controls received in between.
+      app_control_destroy(it->app_control);
+      pending_.erase(it);
+      stats_.merged++;
+      break;
+    }
+  }
+  if (pending_.size() >= max_pending_) {
+    TizenLog::Warn(
+        "Dropped an app control (%s) since %zu app controls are pending.",
+        GetOperation(pending_.front().app_control).c_str(), pending_.size());
+    app_control_destroy(pending_.front().app_control);
+    pending_.erase(pending_.begin());
+    stats_.dropped++;
+  }
+  pending_.push_back({std::move(key), clone});
+  if (!timer_) {
+    // Waiting for the Dart side, which is checked every window.
+    timer_ = ecore_timer_add(window_seconds_, OnWindowEnd, this);
+  }
+}
+
+void FlutterAppControlCoalescer::Flush() {
+  std::vector<PendingAppControl> pending;
+  pending.swap(pending_);
+  for (PendingAppControl &entry : pending) {
+    Deliver(entry.app_control);
+    app_control_destroy(entry.app_control);
+  }
+}
+
+void FlutterAppControlCoalescer::Deliver(app_control_h app_control) {
+  stats_.delivered++;
+  deliver_(app_control);
+}
+
+void FlutterAppControlCoalescer::RequestAck() {
+  if (!is_back_pressure_enabled_) {
+    return;
+  }
+  if (FlutterDesktopMessengerSendWithReply(
+          messenger_, kChannel, nullptr, 0, OnAckReply,
+          reinterpret_cast<void *>(id_))) {
+    unacked_count_++;
+    awaited_windows_ = 0;
+  }
+}
+
+Eina_Bool FlutterAppControlCoalescer::OnWindowEnd(void *data) {
+  auto *self = static_cast<FlutterAppControlCoalescer *>(data);
+  if (self->pending_.empty()) {
+    // The burst is over.
+    self->timer_ = nullptr;
+    return ECORE_CALLBACK_CANCEL;
+  }
+  if (self->IsAwaitingAck()) {
+    self->stats_.awaited_windows++;
+    if (++self->awaited_windows_ < kMaxAwaitedWindows) {
+      // Keep merging until the Dart side has caught up.
+      return ECORE_CALLBACK_RENEW;
+    }
+    TizenLog::Warn(
+        "Delivering %zu app controls since the Dart side has not replied in "
+        "%d windows.",
+        self->pending_.size(), self->awaited_windows_);
+    self->stale_ack_count_ += self->unacked_count_;
+    self->unacked_count_ = 0;
+  }
+  self->Flush();
+  self->RequestAck();
+  // Keep the window open while app controls keep arriving.
+  return ECORE_CALLBACK_RENEW;
+}
+
+void FlutterAppControlCoalescer::OnMessage(
+    FlutterDesktopMessengerRef messenger,
+    const FlutterDesktopMessage *message,
+    void *user_data) {
+  FlutterDesktopMessengerSendResponse(messenger, message->response_handle,
+                                      nullptr, 0);
+  auto *self = static_cast<FlutterAppControlCoalescer *>(user_data);
+  if (!self->is_back_pressure_enabled_) {
+    TizenLog::Debug("App control back-pressure is enabled.");
+    self->is_back_pressure_enabled_ = true;
+  }
+}
+
+void FlutterAppControlCoalescer::OnAckReply(const uint8_t *reply,
+                                            size_t reply_size,
+                                            void *user_data) {
+  auto it = g_coalescers.find(reinterpret_cast<uintptr_t>(user_data));
+  if (it == g_coalescers.end()) {
+    return;
+  }
+  FlutterAppControlCoalescer *self = it->second;
+  if (self->stale_ack_count_ > 0) {
+    self->stale_ack_count_--;
+  } else if (self->unacked_count_ > 0) {
+    self->unacked_count_--;
+  }
+}
@@ -0,0 +1,263 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_channel_benchmark.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "include/flutter_standard_message.h"
+#include "tizen_log.h"
+
+namespace {
+
+using Duration = std::chrono::steady_clock::duration;
+
+// The method of the calls sent in |Codec::kStandardMethod|.
+constexpr char kEchoMethod[] = "echo";
+
+// Returns the |percentile|th latency in milliseconds from |sorted|.
+double GetPercentileMs(const std::vector<Duration>& sorted,
+                       double percentile) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  size_t index = static_cast<size_t>(percentile / 100.0 * (sorted.size() - 1));
+  return std::chrono::duration<double, std::milli>(sorted[index]).count();
+}
+
+}  // namespace
+
+FlutterChannelBenchmark::FlutterChannelBenchmark(
+    FlutterDesktopPluginRegistrarRef registrar, const std::string& channel,
+    Mode mode, Codec codec)
+    : messenger_(FlutterDesktopPluginRegistrarGetMessenger(registrar)),
+      channel_(channel),
+      mode_(mode),
+      codec_(codec) {
+  // The engine may be destroyed by its view before this instance.
+  FlutterDesktopMessengerAddRef(messenger_);
+}
+
+FlutterChannelBenchmark::~FlutterChannelBenchmark() {
+  FlutterDesktopMessengerLock(messenger_);
+  if (is_echo_registered_ && FlutterDesktopMessengerIsAvailable(messenger_)) {
+    FlutterDesktopMessengerSetCallback(messenger_, channel_.c_str(), nullptr,
+                                       nullptr);
+  }
+  FlutterDesktopMessengerUnlock(messenger_);
+  FlutterDesktopMessengerRelease(messenger_);
+}
+
+void FlutterChannelBenchmark::RegisterEchoHandler() {
+  FlutterDesktopMessengerSetCallback(messenger_, channel_.c_str(),
+                                     OnEchoMessage, this);
+  is_echo_registered_ = true;
+}
+
+bool FlutterChannelBenchmark::Run(const std::vector<size_t>& payload_sizes,
+                                  size_t message_count,
+                                  CompletionCallback done) {
+  if (IsRunning()) {
+    TizenLog::Error("A channel benchmark is already running.");
+    return false;
+  }
+  if (std::find(payload_sizes.begin(), payload_sizes.end(), 0) !=
+      payload_sizes.end()) {
+    // An empty reply is also what the sender gets when no handler is set on
+    // the Dart side, so it cannot be told apart from an echo.
+    TizenLog::Error("The payload size of a channel benchmark must be > 0.");
+    return false;
+  }
+  payload_sizes_ = payload_sizes;
+  payload_index_ = 0;
+  message_count_ = std::max<size_t>(message_count, 1);
+  results_.clear();
+  done_ = std::move(done);
+  if (!done_) {
+    done_ = [](const std::vector<Result>&) {};
+  }
+
+  TizenLog::Info("Running a channel benchmark on %s (%s, %s).",
+                 channel_.c_str(),
+                 mode_ == Mode::kEngine ? "engine" : "loopback",
+                 codec_ == Codec::kBinary ? "binary" : "standard method");
+  if (payload_sizes_.empty()) {
+    FinishPayloadSize();
+    return true;
+  }
+  payload_.assign(payload_sizes_[0], 0);
+  latencies_.clear();
+  error_count_ = 0;
+  payload_start_time_ = std::chrono::steady_clock::now();
+  SendNext();
+  return true;
+}
+
+void FlutterChannelBenchmark::SendNext() {
+  if (is_sending_) {
+    is_send_pending_ = true;
+    return;
+  }
+  is_sending_ = true;
+  do {
+    is_send_pending_ = false;
+    if (latencies_.size() + error_count_ >= message_count_) {
+      FinishPayloadSize();
+      continue;
+    }
+    // Vary the contents so that a stale reply cannot pass as an echo.
+    payload_[0] = static_cast<uint8_t>(latencies_.size() + error_count_);
+    send_time_ = std::chrono::steady_clock::now();
+    const uint8_t* message = payload_.data();
+    size_t message_size = payload_.size();
+    if (codec_ == Codec::kStandardMethod) {
+      FlutterStandardMessageWriter writer(payload_.size() + 16);
+      writer.WriteString(kEchoMethod);
+      writer.WriteUint8List(payload_.data(), payload_.size());
+      method_call_ = writer.TakeBuffer();
+      message = method_call_.data();
+      message_size = method_call_.size();
+    }
+    if (mode_ == Mode::kLoopback) {
+      if (codec_ == Codec::kStandardMethod) {
+        std::vector<uint8_t> echo = CreateMethodEcho(message, message_size);
+        OnReply(echo.data(), echo.size());
+      } else {
+        OnReply(message, message_size);
+      }
+    } else if (!FlutterDesktopMessengerSendWithReply(
+                   messenger_, channel_.c_str(), message, message_size,
+                   OnReplyMessage, this)) {
+      TizenLog::Error("Could not send a benchmark message.");
+      error_count_++;
+      is_send_pending_ = true;
+    }
+  } while (is_send_pending_ && IsRunning());
+  is_sending_ = false;
+}
+
+void FlutterChannelBenchmark::OnReply(const uint8_t* reply,
+                                      size_t reply_size) {
+  Duration latency = std::chrono::steady_clock::now() - send_time_;
+  if (IsEcho(reply, reply_size)) {
+    latencies_.push_back(latency);
+  } else {
+    error_count_++;
+  }
+  SendNext();
+}
+
+bool FlutterChannelBenchmark::IsEcho(const uint8_t* reply,
+                                     size_t reply_size) const {
+  if (!reply) {
+    return false;
+  }
+  if (codec_ == Codec::kStandardMethod) {
+    // A success envelope is a 0 byte followed by the result.
+    if (reply_size == 0 || reply[0] != 0) {
+      return false;
+    }
+    FlutterStandardMessageReader reader(reply + 1, reply_size - 1);
+    FlutterStandardValue value;
+    if (!reader.Read(value) ||
+        value.type != FlutterStandardType::kUint8List || !reader.IsAtEnd()) {
+      return false;
+    }
+    reply = value.data;
+    reply_size = value.length;
+  }
+  return reply_size == payload_.size() &&
+         memcmp(reply, payload_.data(), reply_size) == 0;
+}
+
+std::vector<uint8_t> FlutterChannelBenchmark::CreateMethodEcho(
+    const uint8_t* message, size_t message_size) {
+  FlutterStandardMessageReader reader(message, message_size);
+  FlutterStandardValue method;
+  FlutterStandardValue arguments;
+  if (!reader.Read(method) || method.type != FlutterStandardType::kString ||
+      method.AsString() != kEchoMethod || !reader.Read(arguments) ||
+      arguments.type != FlutterStandardType::kUint8List || !reader.IsAtEnd()) {
+    return {};
+  }
+  FlutterStandardMessageWriter writer(arguments.length + 16);
+  // A success envelope is a 0 byte, which is also how null is encoded.
+  writer.WriteNull();
+  writer.WriteUint8List(arguments.data, arguments.length);
+  return writer.TakeBuffer();
+}
+
+void FlutterChannelBenchmark::FinishPayloadSize() {
+  if (payload_index_ < payload_sizes_.size()) {
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - payload_start_time_)
+                         .count();
+    std::sort(latencies_.begin(), latencies_.end());
+
+    Result result;
+    result.payload_size = payload_.size();
+    result.message_count = latencies_.size();
+    result.error_count = error_count_;
+    if (seconds > 0.0) {
+      result.messages_per_second = result.message_count / seconds;
+      // Count the bytes in both directions.
+      result.bytes_per_second =
+          result.messages_per_second * result.payload_size * 2;
+    }
+    result.p50_latency_ms = GetPercentileMs(latencies_, 50);
+    result.p99_latency_ms = GetPercentileMs(latencies_, 99);
+    results_.push_back(result);
+
+    TizenLog::Info(
+        "%zu B: %.0f msg/s, %.2f MB/s, p50 %.3f ms, p99 %.3f ms, %zu "
+        "error(s)",
+        result.payload_size, result.messages_per_second,
+        result.bytes_per_second / (1024 * 1024), result.p50_latency_ms,
+        result.p99_latency_ms, result.error_count);
+    payload_index_++;
+  }
+
+  if (payload_index_ < payload_sizes_.size()) {
+    payload_.assign(payload_sizes_[payload_index_], 0);
+    latencies_.clear();
+    error_count_ = 0;
+    payload_start_time_ = std::chrono::steady_clock::now();
+    is_send_pending_ = true;
+    return;
+  }
+
+  CompletionCallback done = std::move(done_);
+  done_ = nullptr;
+  done(results_);
+}
+
+void FlutterChannelBenchmark::OnEchoMessage(
+    FlutterDesktopMessengerRef messenger, const FlutterDesktopMessage* message,
+    void* user_data) {
+  auto* self = static_cast<FlutterChannelBenchmark*>(user_data);
+  if (self->codec_ == Codec::kBinary) {
+    FlutterDesktopMessengerSendResponse(messenger, message->response_handle,
+                                        message->message,
+                                        message->message_size);
+    self->echo_count_++;
+    return;
+  }
+  // An empty response tells the Dart side that the method is not
+  // implemented.
+  std::vector<uint8_t> echo =
+      CreateMethodEcho(message->message, message->message_size);
+  FlutterDesktopMessengerSendResponse(messenger, message->response_handle,
+                                      echo.data(), echo.size());
+  if (!echo.empty()) {
+    self->echo_count_++;
+  }
+}
+
+void FlutterChannelBenchmark::OnReplyMessage(const uint8_t* reply,
+                                             size_t reply_size,
+                                             void* user_data) {
+  auto* self = static_cast<FlutterChannelBenchmark*>(user_data);
+  self->OnReply(reply, reply_size);
+}
@@ -0,0 +1,115 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_deferred_plugins.h"
+
+#include <chrono>
+
+#include "include/flutter_trace.h"
+#include "tizen_log.h"
+
+FlutterDeferredPlugins::FlutterDeferredPlugins(
+    flutter::PluginRegistry *registry)
+    : registry_(registry) {}
+
+FlutterDeferredPlugins::~FlutterDeferredPlugins() {
+  if (delay_timer_) {
+    ecore_timer_del(delay_timer_);
+  }
+  if (idler_) {
+    ecore_idler_del(idler_);
+  }
+}
+
+void FlutterDeferredPlugins::Register(const std::string &name,
+                                      RegisterFunction register_function) {
+  plugins_.push_back({name, register_function});
+  RegisterPlugin(plugins_.back());
+}
+
+void FlutterDeferredPlugins::Defer(const std::string &name,
+                                   RegisterFunction register_function) {
+  plugins_.push_back({name, register_function});
+}
+
+void FlutterDeferredPlugins::ScheduleIdleRegistration(double delay_seconds) {
+  if (delay_timer_ || idler_) {
+    return;
+  }
+  if (delay_seconds > 0.0) {
+    delay_timer_ = ecore_timer_add(delay_seconds, OnDelayEnd, this);
+  } else {
+    idler_ = ecore_idler_add(OnIdle, this);
+  }
+}
+
+bool FlutterDeferredPlugins::EnsureRegistered(const std::string &name) {
+  for (Plugin &plugin : plugins_) {
+    if (plugin.name == name) {
+      if (!plugin.is_registered) {
+        RegisterPlugin(plugin);
+      }
+      return true;
+    }
+  }
+  TizenLog::Warn("No plugin named %s has been added.", name.c_str());
+  return false;
+}
+
+void FlutterDeferredPlugins::RegisterAll() {
+  for (Plugin &plugin : plugins_) {
+    if (!plugin.is_registered) {
+      RegisterPlugin(plugin);
+    }
+  }
+}
+
+bool FlutterDeferredPlugins::IsRegistered(const std::string &name) const {
+  for (const Plugin &plugin : plugins_) {
+    if (plugin.name == name) {
+      return plugin.is_registered;
+    }
+  }
+  return false;
+}
+
+void FlutterDeferredPlugins::RegisterPlugin(Plugin &plugin) {
+  FLUTTER_TRACE_SCOPE("FlutterDeferredPlugins::RegisterPlugin");
+  FlutterDesktopPluginRegistrarRef registrar =
+      registry_->GetRegistrarForPlugin(plugin.name);
+  if (!registrar) {
+    TizenLog::Error("Could not get a registrar for %s.", plugin.name.c_str());
+    return;
+  }
+  auto start = std::chrono::steady_clock::now();
+  plugin.register_function(registrar);
+  plugin.is_registered = true;
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+  TizenLog::Info("Registered %s in %lld us.", plugin.name.c_str(),
+                 static_cast<long long>(elapsed.count()));
+}
+
+Eina_Bool FlutterDeferredPlugins::OnDelayEnd(void *data) {
+  auto *self = static_cast<FlutterDeferredPlugins *>(data);
+  self->delay_timer_ = nullptr;
+  self->idler_ = ecore_idler_add(OnIdle, self);
+  return ECORE_CALLBACK_CANCEL;
+}
+
+Eina_Bool FlutterDeferredPlugins::OnIdle(void *data) {
+  auto *self = static_cast<FlutterDeferredPlugins *>(data);
+  // Register one plugin per idle period so that the main loop can handle
+  // other events in between.
+  for (Plugin &plugin : self->plugins_) {
+    if (!plugin.is_registered) {
+      self->RegisterPlugin(plugin);
+      if (plugin.is_registered) {
+        return ECORE_CALLBACK_RENEW;
+      }
+    }
+  }
+  self->idler_ = nullptr;
+  return ECORE_CALLBACK_CANCEL;
+}
@@ -8,12 +8,31 @@
 
 #include <algorithm>
 
+#include "include/flutter_icu_data.h"
+#include "include/flutter_trace.h"
+
+namespace {
+
+constexpr char kDefaultAssetsPath[] = "../res/flutter_assets";
+constexpr char kDefaultIcuDataPath[] = "../res/icudtl.dat";
+constexpr char kDefaultAotLibraryPath[] = "../lib/libapp.so";
+
+// Returns the ICU data path used by default, preferring shared data.
+//
+// Resolved once per process, since all engines use the same data.
+const std::string& GetDefaultIcuDataPath() {
+  static const std::string path = FlutterIcuData::Resolve(kDefaultIcuDataPath);
+  return path;
+}
+
+}  // namespace
+
 std::unique_ptr<FlutterEngine> FlutterEngine::Create(
     const std::string& dart_entrypoint,
     const std::vector<std::string>& dart_entrypoint_args,
     FlutterDesktopUIThreadPolicy ui_thread_policy) {
-  return FlutterEngine::Create("../res/flutter_assets", "../res/icudtl.dat",
-                               "../lib/libapp.so", dart_entrypoint,
+  return FlutterEngine::Create(kDefaultAssetsPath, GetDefaultIcuDataPath(),
+                               kDefaultAotLibraryPath, dart_entrypoint,
                                dart_entrypoint_args, ui_thread_policy);
 }
 
@@ -22,10 +41,31 @@ std::unique_ptr<FlutterEngine> FlutterEngine::Create(
     const std::string& aot_library_path, const std::string& dart_entrypoint,
     const std::vector<std::string>& dart_entrypoint_args,
     FlutterDesktopUIThreadPolicy ui_thread_policy) {
-  FlutterEngine* engine =
-      new FlutterEngine(assets_path, icu_data_path, aot_library_path,
-                        dart_entrypoint, dart_entrypoint_args,
-                        ui_thread_policy);
+  FlutterEngine* engine = new FlutterEngine(
+      std::make_shared<FlutterEngineArguments>(), assets_path, icu_data_path,
+      aot_library_path, dart_entrypoint, dart_entrypoint_args,
+      ui_thread_policy);
+  if (engine->engine_) {
+    return std::unique_ptr<FlutterEngine>(engine);
+  } else {
+    delete engine;
+    return nullptr;
+  }
+}
+
+std::unique_ptr<FlutterEngine> FlutterEngine::Create(
+    std::shared_ptr<const FlutterEngineArguments> arguments,
+    const std::string& dart_entrypoint,
+    const std::vector<std::string>& dart_entrypoint_args,
+    FlutterDesktopUIThreadPolicy ui_thread_policy) {
+  if (!arguments) {
+    return FlutterEngine::Create(dart_entrypoint, dart_entrypoint_args,
+                                 ui_thread_policy);
+  }
+  FlutterEngine* engine = new FlutterEngine(
+      std::move(arguments), kDefaultAssetsPath, GetDefaultIcuDataPath(),
+      kDefaultAotLibraryPath, dart_entrypoint, dart_entrypoint_args,
+      ui_thread_policy);
   if (engine->engine_) {
     return std::unique_ptr<FlutterEngine>(engine);
   } else {
@@ -35,12 +75,13 @@ std::unique_ptr<FlutterEngine> FlutterEngine::Create(
 }
 
 FlutterEngine::FlutterEngine(
+    std::shared_ptr<const FlutterEngineArguments> arguments,
     const std::string& assets_path, const std::string& icu_data_path,
     const std::string& aot_library_path, const std::string& dart_entrypoint,
     const std::vector<std::string>& dart_entrypoint_args,
-    FlutterDesktopUIThreadPolicy ui_thread_policy) {
-  engine_arguments_ = std::make_unique<FlutterEngineArguments>();
-
+    FlutterDesktopUIThreadPolicy ui_thread_policy)
+    : engine_arguments_(std::move(arguments)) {
+  FLUTTER_TRACE_SCOPE("FlutterEngine::Create");
   FlutterDesktopEngineProperties engine_prop = {};
   engine_prop.assets_path = assets_path.c_str();
   engine_prop.icu_data_path = icu_data_path.c_str();
@@ -67,7 +108,10 @@ FlutterEngine::FlutterEngine(
   engine_prop.dart_entrypoint_argv = entrypoint_args.data();
   engine_prop.ui_thread_policy = ui_thread_policy;
 
-  engine_ = FlutterDesktopEngineCreate(engine_prop);
+  {
+    FLUTTER_TRACE_SCOPE("FlutterDesktopEngineCreate");
+    engine_ = FlutterDesktopEngineCreate(engine_prop);
+  }
 }
 
 FlutterEngine::~FlutterEngine() {
@@ -77,16 +121,20 @@ FlutterEngine::~FlutterEngine() {
 }
 
 bool FlutterEngine::Run() {
+  FLUTTER_TRACE_SCOPE("FlutterEngine::Run");
   if (engine_) {
-    return FlutterDesktopEngineRun(engine_);
+    is_running_ = FlutterDesktopEngineRun(engine_);
+    return is_running_;
   }
   return false;
 }
 
 void FlutterEngine::Shutdown() {
   if (engine_) {
+    memory_stats_ = nullptr;
     FlutterDesktopEngineShutdown(engine_);
     engine_ = nullptr;
+    is_running_ = false;
   }
 }
 
@@ -131,6 +179,21 @@ FlutterDesktopEngineRef FlutterEngine::RelinquishEngine() {
   return engine_;
 }
 
+FlutterDesktopMessengerRef FlutterEngine::GetMessenger() {
+  if (engine_) {
+    return FlutterDesktopEngineGetMessenger(engine_);
+  }
+  return nullptr;
+}
+
+FlutterMemoryStats* FlutterEngine::GetMemoryStats() {
+  if (!memory_stats_ && engine_) {
+    memory_stats_ = std::make_unique<FlutterMemoryStats>(
+        FlutterDesktopEngineGetMessenger(engine_));
+  }
+  return memory_stats_.get();
+}
+
 FlutterDesktopPluginRegistrarRef FlutterEngine::GetRegistrarForPlugin(
     const std::string& plugin_name) {
   if (engine_) {
@@ -4,9 +4,16 @@
 
 #include "include/flutter_engine_arguments.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <algorithm>
 #include <cerrno>
+#include <cstring>
 
+#include "include/flutter_engine_profile.h"
+#include "include/flutter_trace.h"
 #include "tizen_log.h"
 
 namespace {
@@ -16,6 +23,34 @@ static constexpr const char* kMetadataKeyEnableImepeller =
 static constexpr const char* kMetadataKeyEnableFlutterGpu =
     "http://tizen.org/metadata/flutter_tizen/enable_flutter_gpu";
 
+static constexpr const char* kEngineProfileFileName =
+    "flutter_engine_profile.ini";
+
+static constexpr const char* kMetadataCacheFileName =
+    ".flutter_engine_arguments.cache";
+static constexpr char kMetadataCacheMagic[4] = {'F', 'T', 'E', 'A'};
+static constexpr uint32_t kMetadataCacheVersion = 2;
+
+// The layout of the metadata cache file. The header is followed by
+// |key_length| bytes of the cache key.
+struct MetadataCacheHeader {
+  char magic[4];
+  uint32_t version;
+  int64_t manifest_mtime_sec;
+  int64_t manifest_mtime_nsec;
+  int64_t manifest_size;
+  uint8_t enable_impeller;
+  uint8_t enable_flutter_gpu;
+  uint8_t reserved[2];
+  uint32_t key_length;
+};
+
+std::string TakeString(char* value) {
+  std::string result = value ? value : "";
+  free(value);
+  return result;
+}
+
 }  // namespace
 
 FlutterEngineArguments::FlutterEngineArguments() {
@@ -23,6 +58,7 @@ FlutterEngineArguments::FlutterEngineArguments() {
 }
 
 std::vector<std::string> FlutterEngineArguments::ParseEngineArgs() {
+  FLUTTER_TRACE_SCOPE("FlutterEngineArguments::ParseEngineArgs");
   std::vector<std::string> engine_args;
   char* id;
   if (app_get_id(&id) != 0) {
@@ -53,13 +89,23 @@ std::vector<std::string> FlutterEngineArguments::ParseEngineArgs() {
     }
   }
 
-  std::map<std::string, std::string> metadata = GetMetadata(app_id);
+  ApplyEngineProfile(engine_args);
+
+  Metadata metadata = GetMetadata(app_id);
 
   is_impeller_enabled_ = ProcessMetadataFlag(
-      engine_args, "--enable-impeller", kMetadataKeyEnableImepeller, metadata);
-  is_flutter_gpu_enabled_ =
-      ProcessMetadataFlag(engine_args, "--enable-flutter-gpu",
-                          kMetadataKeyEnableFlutterGpu, metadata);
+      engine_args, "--enable-impeller", metadata.enable_impeller);
+  is_flutter_gpu_enabled_ = ProcessMetadataFlag(
+      engine_args, "--enable-flutter-gpu", metadata.enable_flutter_gpu);
+
+  if (renderer_type_ == FlutterDesktopRendererType::kVulkan &&
+      !is_impeller_enabled_) {
+    TizenLog::Warn(
+        "The Vulkan renderer set by the engine profile is ignored since it "
+        "requires Impeller. Enable Impeller using the --enable-impeller "
+        "flag.");
+    renderer_type_.reset();
+  }
 
   for (const std::string& arg : engine_args) {
     TizenLog::Info("Enabled: %s", arg.c_str());
@@ -68,34 +114,176 @@ std::vector<std::string> FlutterEngineArguments::ParseEngineArgs() {
   return engine_args;
 }
 
-std::map<std::string, std::string> FlutterEngineArguments::GetMetadata(
+FlutterEngineArguments::Metadata FlutterEngineArguments::GetMetadata(
     const std::string& app_id) {
-  std::map<std::string, std::string> map;
+  FLUTTER_TRACE_SCOPE("FlutterEngineArguments::GetMetadata");
+  // The cache is invalidated whenever the installed manifest changes (i.e.
+  // the package is updated or reinstalled), which is detected from its stat
+  // alone. Querying the app version would cost a package database lookup on
+  // every launch.
+  std::string data_path = TakeString(app_get_data_path());
+  std::string resource_path = TakeString(app_get_resource_path());
+  struct stat manifest_stat;
+  if (data_path.empty() || resource_path.empty() ||
+      stat((resource_path + "../tizen-manifest.xml").c_str(),
+           &manifest_stat) != 0) {
+    return ReadMetadata(app_id);
+  }
+
+  const std::string& cache_key = app_id;
+  std::string cache_path = data_path + kMetadataCacheFileName;
+
+  Metadata metadata;
+  if (ReadMetadataCache(cache_path, cache_key, manifest_stat, metadata)) {
+    return metadata;
+  }
+  metadata = ReadMetadata(app_id);
+  WriteMetadataCache(cache_path, cache_key, manifest_stat, metadata);
+  return metadata;
+}
+
+FlutterEngineArguments::Metadata FlutterEngineArguments::ReadMetadata(
+    const std::string& app_id) {
+  FLUTTER_TRACE_SCOPE("FlutterEngineArguments::ReadMetadata");
+  Metadata metadata;
   app_info_h app_info;
   int ret = app_manager_get_app_info(app_id.c_str(), &app_info);
   if (ret != APP_MANAGER_ERROR_NONE) {
     TizenLog::Error("Failed to retrieve app info.");
-    return map;
+    return metadata;
   }
 
   ret = app_info_foreach_metadata(
       app_info,
       [](const char* key, const char* value, void* user_data) -> bool {
-        auto* map = static_cast<std::map<std::string, std::string>*>(user_data);
-        map->insert(std::pair<std::string, std::string>(key, value));
+        auto* metadata = static_cast<Metadata*>(user_data);
+        MetadataValue parsed = strcmp(value, "true") == 0
+                                   ? MetadataValue::kTrue
+                                   : MetadataValue::kFalse;
+        if (strcmp(key, kMetadataKeyEnableImepeller) == 0) {
+          metadata->enable_impeller = parsed;
+        } else if (strcmp(key, kMetadataKeyEnableFlutterGpu) == 0) {
+          metadata->enable_flutter_gpu = parsed;
+        }
         return true;
       },
-      &map);
+      &metadata);
   if (ret != APP_MANAGER_ERROR_NONE) {
     TizenLog::Error("Failed to get app metadata.");
   }
-  return map;
+  app_info_destroy(app_info);
+  return metadata;
+}
+
+bool FlutterEngineArguments::ReadMetadataCache(
+    const std::string& cache_path, const std::string& cache_key,
+    const struct stat& manifest_stat, Metadata& metadata) {
+  int fd = open(cache_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat cache_stat;
+  if (fstat(fd, &cache_stat) != 0 ||
+      static_cast<size_t>(cache_stat.st_size) < sizeof(MetadataCacheHeader)) {
+    close(fd);
+    return false;
+  }
+  size_t size = cache_stat.st_size;
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+
+  const auto* header = static_cast<const MetadataCacheHeader*>(mapping);
+  const char* key = static_cast<const char*>(mapping) + sizeof(*header);
+  bool valid =
+      memcmp(header->magic, kMetadataCacheMagic, sizeof(header->magic)) == 0 &&
+      header->version == kMetadataCacheVersion &&
+      header->manifest_mtime_sec == manifest_stat.st_mtim.tv_sec &&
+      header->manifest_mtime_nsec == manifest_stat.st_mtim.tv_nsec &&
+      header->manifest_size == manifest_stat.st_size &&
+      header->enable_impeller <= static_cast<uint8_t>(MetadataValue::kTrue) &&
+      header->enable_flutter_gpu <=
+          static_cast<uint8_t>(MetadataValue::kTrue) &&
+      header->key_length == cache_key.size() &&
+      size - sizeof(*header) >= header->key_length &&
+      memcmp(key, cache_key.data(), cache_key.size()) == 0;
+  if (valid) {
+    metadata.enable_impeller =
+        static_cast<MetadataValue>(header->enable_impeller);
+    metadata.enable_flutter_gpu =
+        static_cast<MetadataValue>(header->enable_flutter_gpu);
+  }
+  munmap(mapping, size);
+  return valid;
+}
+
+void FlutterEngineArguments::WriteMetadataCache(
+    const std::string& cache_path, const std::string& cache_key,
+    const struct stat& manifest_stat, const Metadata& metadata) {
+  MetadataCacheHeader header = {};
+  memcpy(header.magic, kMetadataCacheMagic, sizeof(header.magic));
+  header.version = kMetadataCacheVersion;
+  header.manifest_mtime_sec = manifest_stat.st_mtim.tv_sec;
+  header.manifest_mtime_nsec = manifest_stat.st_mtim.tv_nsec;
+  header.manifest_size = manifest_stat.st_size;
+  header.enable_impeller = static_cast<uint8_t>(metadata.enable_impeller);
+  header.enable_flutter_gpu = static_cast<uint8_t>(metadata.enable_flutter_gpu);
+  header.key_length = cache_key.size();
+
+  // Write to a temporary file first so that a concurrent reader never sees a
+  // partially written cache.
+  std::string temp_path = cache_path + ".tmp";
+  FILE* file = fopen(temp_path.c_str(), "wb");
+  if (!file) {
+    TizenLog::Warn("Could not create %s: %s", temp_path.c_str(),
+                   strerror(errno));
+    return;
+  }
+  bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                 fwrite(cache_key.data(), 1, cache_key.size(), file) ==
+                     cache_key.size();
+  if (fclose(file) != 0 || !written ||
+      rename(temp_path.c_str(), cache_path.c_str()) != 0) {
+    TizenLog::Warn("Could not write %s.", cache_path.c_str());
+    remove(temp_path.c_str());
+  }
+}
+
+void FlutterEngineArguments::ApplyEngineProfile(
+    std::vector<std::string>& engine_args) {
+  FLUTTER_TRACE_SCOPE("FlutterEngineArguments::ApplyEngineProfile");
+  std::string resource_path = TakeString(app_get_resource_path());
+  if (resource_path.empty()) {
+    return;
+  }
+  FlutterEngineProfileSettings settings;
+  std::string error;
+  if (!FlutterEngineProfile::Evaluate(resource_path + kEngineProfileFileName,
+                                      FlutterDeviceInfo::Get(), settings,
+                                      error)) {
+    TizenLog::Error("Invalid engine profile: %s", error.c_str());
+    return;
+  }
+  for (const std::string& engine_switch : settings.switches) {
+    std::string name = engine_switch.substr(0, engine_switch.find('='));
+    bool is_overridden =
+        std::any_of(engine_args.begin(), engine_args.end(),
+                    [&name](const std::string& arg) {
+                      return arg.substr(0, arg.find('=')) == name;
+                    });
+    if (!is_overridden) {
+      engine_args.push_back(engine_switch);
+    }
+  }
+  pixel_ratio_ = settings.pixel_ratio;
+  renderer_type_ = settings.renderer_type;
 }
 
 bool FlutterEngineArguments::ProcessMetadataFlag(
     std::vector<std::string>& engine_args, const std::string& flag,
-    const std::string& metadata_key,
-    const std::map<std::string, std::string>& metadata) {
+    MetadataValue value) {
   bool enabled = false;
   auto flag_it = std::find(engine_args.begin(), engine_args.end(), flag);
   bool flag_exists = (flag_it != engine_args.end());
@@ -104,9 +292,8 @@ bool FlutterEngineArguments::ProcessMetadataFlag(
     enabled = true;
   }
 
-  auto metadata_it = metadata.find(metadata_key);
-  if (metadata_it != metadata.end()) {
-    bool metadata_enabled = (metadata_it->second == "true");
+  if (value != MetadataValue::kNotSet) {
+    bool metadata_enabled = (value == MetadataValue::kTrue);
 
     if (!flag_exists && metadata_enabled) {
       enabled = true;
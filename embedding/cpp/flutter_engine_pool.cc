@@ -0,0 +1,106 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_engine_pool.h"
+
+#include "tizen_log.h"
+
+FlutterEnginePool::FlutterEnginePool(
+    const std::string& dart_entrypoint,
+    const std::vector<std::string>& dart_entrypoint_args,
+    FlutterDesktopUIThreadPolicy ui_thread_policy)
+    : dart_entrypoint_(dart_entrypoint),
+      dart_entrypoint_args_(dart_entrypoint_args),
+      ui_thread_policy_(ui_thread_policy) {}
+
+FlutterEnginePool::~FlutterEnginePool() {
+  Clear();
+  if (arguments_future_.valid()) {
+    arguments_future_.wait();
+  }
+}
+
+void FlutterEnginePool::PreloadArguments() {
+  if (arguments_ || arguments_future_.valid()) {
+    return;
+  }
+  arguments_future_ = std::async(std::launch::async, []() {
+    return std::shared_ptr<const FlutterEngineArguments>(
+        std::make_shared<FlutterEngineArguments>());
+  });
+}
+
+size_t FlutterEnginePool::Prewarm(size_t count, bool run) {
+  std::vector<std::unique_ptr<FlutterEngine>>& engines =
+      run ? running_engines_ : engines_;
+  while (engines.size() < count) {
+    std::unique_ptr<FlutterEngine> engine =
+        FlutterEngine::Create(GetArguments(), dart_entrypoint_,
+                              dart_entrypoint_args_, ui_thread_policy_);
+    if (!engine) {
+      TizenLog::Error("Could not create a spare Flutter engine.");
+      break;
+    }
+    if (run && !engine->Run()) {
+      TizenLog::Error("Could not run a spare Flutter engine.");
+      break;
+    }
+    engines.push_back(std::move(engine));
+  }
+  return engines.size();
+}
+
+std::unique_ptr<FlutterEngine> FlutterEnginePool::Acquire() {
+  if (!engines_.empty()) {
+    std::unique_ptr<FlutterEngine> engine = std::move(engines_.back());
+    engines_.pop_back();
+    return engine;
+  }
+  return FlutterEngine::Create(GetArguments(), dart_entrypoint_,
+                               dart_entrypoint_args_, ui_thread_policy_);
+}
+
+std::unique_ptr<FlutterEngine> FlutterEnginePool::Acquire(
+    const std::string& dart_entrypoint,
+    const std::vector<std::string>& dart_entrypoint_args) {
+  if (dart_entrypoint == dart_entrypoint_ &&
+      dart_entrypoint_args == dart_entrypoint_args_) {
+    return Acquire();
+  }
+  return FlutterEngine::Create(GetArguments(), dart_entrypoint,
+                               dart_entrypoint_args, ui_thread_policy_);
+}
+
+std::unique_ptr<FlutterEngine> FlutterEnginePool::AcquireRunning() {
+  if (!running_engines_.empty()) {
+    std::unique_ptr<FlutterEngine> engine = std::move(running_engines_.back());
+    running_engines_.pop_back();
+    return engine;
+  }
+  std::unique_ptr<FlutterEngine> engine =
+      FlutterEngine::Create(GetArguments(), dart_entrypoint_,
+                            dart_entrypoint_args_, ui_thread_policy_);
+  if (engine && !engine->Run()) {
+    TizenLog::Error("Could not run a Flutter engine.");
+    return nullptr;
+  }
+  return engine;
+}
+
+void FlutterEnginePool::Clear() {
+  engines_.clear();
+  running_engines_.clear();
+}
+
+std::shared_ptr<const FlutterEngineArguments>
+FlutterEnginePool::GetArguments() {
+  if (!arguments_) {
+    if (arguments_future_.valid()) {
+      arguments_ = arguments_future_.get();
+    } else {
+      arguments_ = std::make_shared<FlutterEngineArguments>();
+    }
+  }
+  return arguments_;
+}
@@ -0,0 +1,243 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_engine_profile.h"
+
+#include <sys/sysinfo.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include "include/flutter_trace.h"
+
+namespace {
+
+#if defined(TV_PROFILE)
+constexpr char kDeviceProfile[] = "tv";
+#elif defined(MOBILE_PROFILE)
+constexpr char kDeviceProfile[] = "mobile";
+#elif defined(WEARABLE_PROFILE)
+constexpr char kDeviceProfile[] = "wearable";
+#else
+constexpr char kDeviceProfile[] = "common";
+#endif
+
+// The comparison operators, in the order they are matched.
+constexpr const char* kOperators[] = {"==", "!=", "<=", ">=", "<", ">"};
+
+std::string Trim(const std::string& value) {
+  size_t start = value.find_first_not_of(" \t\r");
+  if (start == std::string::npos) {
+    return "";
+  }
+  size_t end = value.find_last_not_of(" \t\r");
+  return value.substr(start, end - start + 1);
+}
+
+bool ParseInteger(const std::string& value, int64_t& result) {
+  if (value.empty()) {
+    return false;
+  }
+  char* end;
+  result = strtoll(value.c_str(), &end, 10);
+  return *end == '\0';
+}
+
+template <typename T>
+bool Compare(const T& lhs, const std::string& op, const T& rhs) {
+  if (op == "==") {
+    return lhs == rhs;
+  } else if (op == "!=") {
+    return lhs != rhs;
+  } else if (op == "<=") {
+    return lhs <= rhs;
+  } else if (op == ">=") {
+    return lhs >= rhs;
+  } else if (op == "<") {
+    return lhs < rhs;
+  } else {
+    return lhs > rhs;
+  }
+}
+
+// Evaluates a single condition such as "memory_mb < 1024" for |device|.
+bool EvaluateCondition(const std::string& condition,
+                       const FlutterDeviceInfo& device, bool& result,
+                       std::string& error) {
+  for (const char* op : kOperators) {
+    size_t position = condition.find(op);
+    if (position == std::string::npos) {
+      continue;
+    }
+    std::string key = Trim(condition.substr(0, position));
+    std::string value = Trim(condition.substr(position + strlen(op)));
+    if (key == "profile") {
+      if (strcmp(op, "==") != 0 && strcmp(op, "!=") != 0) {
+        error = "profile can only be compared with == or !=";
+        return false;
+      }
+      result = Compare(device.profile, op, value);
+      return true;
+    }
+    int64_t number;
+    if (!ParseInteger(value, number)) {
+      error = "Invalid number: " + value;
+      return false;
+    }
+    if (key == "memory_mb") {
+      result = Compare(device.memory_mb, op, number);
+    } else if (key == "cpu_count") {
+      result = Compare(device.cpu_count, op, number);
+    } else {
+      error = "Unknown key: " + key;
+      return false;
+    }
+    return true;
+  }
+  error = "Invalid condition: " + condition;
+  return false;
+}
+
+// Evaluates a comma-separated list of conditions for |device|.
+bool EvaluateConditions(const std::string& conditions,
+                        const FlutterDeviceInfo& device, bool& result,
+                        std::string& error) {
+  result = true;
+  size_t start = 0;
+  while (start <= conditions.size()) {
+    size_t end = conditions.find(',', start);
+    if (end == std::string::npos) {
+      end = conditions.size();
+    }
+    std::string condition = Trim(conditions.substr(start, end - start));
+    start = end + 1;
+    if (condition.empty()) {
+      if (end == conditions.size()) {
+        break;
+      }
+      error = "Empty condition";
+      return false;
+    }
+    bool holds;
+    if (!EvaluateCondition(condition, device, holds, error)) {
+      return false;
+    }
+    result = result && holds;
+  }
+  return true;
+}
+
+// Adds |engine_switch| to |switches|, replacing any switch with the same
+// name.
+void AddSwitch(std::vector<std::string>& switches,
+               const std::string& engine_switch) {
+  std::string name = engine_switch.substr(0, engine_switch.find('='));
+  switches.erase(std::remove_if(switches.begin(), switches.end(),
+                                [&name](const std::string& value) {
+                                  return value.substr(0, value.find('=')) ==
+                                         name;
+                                }),
+                 switches.end());
+  switches.push_back(engine_switch);
+}
+
+// Applies a "key = value" setting to |settings|.
+bool ApplySetting(const std::string& key, const std::string& value,
+                  FlutterEngineProfileSettings& settings, std::string& error) {
+  if (key == "pixel_ratio") {
+    char* end;
+    double pixel_ratio = strtod(value.c_str(), &end);
+    if (value.empty() || *end != '\0' || pixel_ratio <= 0.0) {
+      error = "Invalid pixel ratio: " + value;
+      return false;
+    }
+    settings.pixel_ratio = pixel_ratio;
+  } else if (key == "renderer") {
+    if (value == "egl") {
+      settings.renderer_type = FlutterDesktopRendererType::kEGL;
+    } else if (value == "vulkan") {
+      settings.renderer_type = FlutterDesktopRendererType::kVulkan;
+    } else {
+      error = "Invalid renderer: " + value;
+      return false;
+    }
+  } else {
+    error = "Unknown setting: " + key;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+FlutterDeviceInfo FlutterDeviceInfo::Get() {
+  FlutterDeviceInfo device;
+  struct sysinfo info;
+  if (sysinfo(&info) == 0) {
+    device.memory_mb =
+        static_cast<int64_t>(info.totalram) * info.mem_unit / (1024 * 1024);
+  }
+  device.cpu_count = sysconf(_SC_NPROCESSORS_CONF);
+  device.profile = kDeviceProfile;
+  return device;
+}
+
+bool FlutterEngineProfile::Evaluate(const std::string& path,
+                                    const FlutterDeviceInfo& device,
+                                    FlutterEngineProfileSettings& settings,
+                                    std::string& error) {
+  FLUTTER_TRACE_SCOPE("FlutterEngineProfile::Evaluate");
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    return true;
+  }
+
+  FlutterEngineProfileSettings result = settings;
+  // Whether a rule has started and whether its conditions hold.
+  bool in_rule = false;
+  bool is_matched = false;
+  std::string line;
+  for (int line_number = 1; std::getline(file, line); line_number++) {
+    line = Trim(line);
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::string line_error;
+    if (line[0] == '[') {
+      if (line.back() != ']') {
+        line_error = "Missing ]";
+      } else {
+        in_rule = true;
+        EvaluateConditions(line.substr(1, line.size() - 2), device,
+                           is_matched, line_error);
+      }
+    } else if (!in_rule) {
+      line_error = "Setting outside of a rule";
+    } else if (line.rfind("--", 0) == 0) {
+      if (is_matched) {
+        AddSwitch(result.switches, line);
+      }
+    } else {
+      size_t position = line.find('=');
+      if (position == std::string::npos) {
+        line_error = "Invalid setting: " + line;
+      } else {
+        // Settings of rules which do not match are validated as well.
+        FlutterEngineProfileSettings unused;
+        ApplySetting(Trim(line.substr(0, position)),
+                     Trim(line.substr(position + 1)),
+                     is_matched ? result : unused, line_error);
+      }
+    }
+    if (!line_error.empty()) {
+      error = path + ":" + std::to_string(line_number) + ": " + line_error;
+      return false;
+    }
+  }
+  settings = std::move(result);
+  return true;
+}
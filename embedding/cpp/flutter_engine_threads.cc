@@ -0,0 +1,418 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_engine_threads.h"
+
+#include <dirent.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#include "tizen_log.h"
+
+namespace {
+
+constexpr size_t kMaxThreadNameLength = 15;
+
+// The types of the threads renamed by |FlutterEngineThreads::Apply|, which
+// can no longer be identified by their names.
+std::mutex g_renamed_threads_mutex;
+std::map<pid_t, FlutterEngineThreadType> g_renamed_threads;
+
+bool EndsWith(const std::string &value, const char *suffix) {
+  size_t length = strlen(suffix);
+  return value.size() >= length &&
+         value.compare(value.size() - length, length, suffix) == 0;
+}
+
+std::string ReadThreadName(pid_t tid) {
+  char path[64];
+  snprintf(path, sizeof(path), "/proc/self/task/%d/comm", tid);
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    return "";
+  }
+  char name[32] = {};
+  if (!fgets(name, sizeof(name), file)) {
+    name[0] = '\0';
+  }
+  fclose(file);
+  std::string result(name);
+  if (!result.empty() && result.back() == '\n') {
+    result.pop_back();
+  }
+  return result;
+}
+
+// Returns the CPU that |tid| last ran on, or -1 if unknown.
+int ReadLastCpu(pid_t tid) {
+  char path[64];
+  snprintf(path, sizeof(path), "/proc/self/task/%d/stat", tid);
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    return -1;
+  }
+  char buffer[1024] = {};
+  size_t length = fread(buffer, 1, sizeof(buffer) - 1, file);
+  fclose(file);
+  buffer[length] = '\0';
+
+  // The thread name in the second field may contain spaces, so start
+  // counting fields after its closing parenthesis.
+  const char *field = strrchr(buffer, ')');
+  if (!field) {
+    return -1;
+  }
+  // The "processor" field is the 39th field, and the field after ")" is the
+  // 3rd one.
+  for (int index = 3; index <= 39; index++) {
+    field = strchr(field + 1, ' ');
+    if (!field) {
+      return -1;
+    }
+  }
+  return atoi(field + 1);
+}
+
+const char *GetThreadTypeName(FlutterEngineThreadType type) {
+  switch (type) {
+    case FlutterEngineThreadType::kPlatform:
+      return "platform";
+    case FlutterEngineThreadType::kUI:
+      return "ui";
+    case FlutterEngineThreadType::kRaster:
+      return "raster";
+    case FlutterEngineThreadType::kIO:
+      return "io";
+  }
+  return "unknown";
+}
+
+bool ValidateSettings(const FlutterEngineThreadSettings &settings,
+                      FlutterEngineThreadType type, std::string &error) {
+  std::string prefix = std::string(GetThreadTypeName(type)) + " thread: ";
+  if (settings.cpu_affinity_mask) {
+    long cpu_count = sysconf(_SC_NPROCESSORS_CONF);
+    uint64_t valid_mask =
+        cpu_count >= 64 ? ~0ull : (1ull << std::max(cpu_count, 1l)) - 1;
+    if (*settings.cpu_affinity_mask == 0 ||
+        (*settings.cpu_affinity_mask & ~valid_mask) != 0) {
+      error = prefix + "The CPU affinity mask must select at least one of " +
+              std::to_string(cpu_count) + " CPUs.";
+      return false;
+    }
+  }
+  if (settings.nice_value &&
+      (*settings.nice_value < -20 || *settings.nice_value > 19)) {
+    error = prefix + "The nice value must be between -20 and 19.";
+    return false;
+  }
+  if (settings.realtime_priority) {
+    int min = sched_get_priority_min(SCHED_FIFO);
+    int max = sched_get_priority_max(SCHED_FIFO);
+    if (*settings.realtime_priority < min ||
+        *settings.realtime_priority > max) {
+      error = prefix + "The real-time priority must be between " +
+              std::to_string(min) + " and " + std::to_string(max) + ".";
+      return false;
+    }
+    if (settings.nice_value) {
+      error = prefix +
+              "The nice value and the real-time priority cannot be combined.";
+      return false;
+    }
+  }
+  if (settings.name && (settings.name->empty() ||
+                        settings.name->size() > kMaxThreadNameLength)) {
+    error = prefix + "The name must be 1 to 15 characters long.";
+    return false;
+  }
+  return true;
+}
+
+bool ApplySettings(const FlutterEngineThread &thread,
+                   const FlutterEngineThreadSettings &settings) {
+  bool result = true;
+  if (settings.cpu_affinity_mask) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; cpu++) {
+      if (*settings.cpu_affinity_mask & (1ull << cpu)) {
+        CPU_SET(cpu, &cpu_set);
+      }
+    }
+    if (sched_setaffinity(thread.tid, sizeof(cpu_set), &cpu_set) != 0) {
+      TizenLog::Error("Could not set the CPU affinity of %s: %s",
+                      thread.name.c_str(), strerror(errno));
+      result = false;
+    }
+  }
+  if (settings.realtime_priority) {
+    struct sched_param param = {};
+    param.sched_priority = *settings.realtime_priority;
+    if (sched_setscheduler(thread.tid, SCHED_FIFO, &param) != 0) {
+      TizenLog::Error("Could not set the real-time priority of %s: %s",
+                      thread.name.c_str(), strerror(errno));
+      result = false;
+    }
+  }
+  if (settings.nice_value &&
+      setpriority(PRIO_PROCESS, thread.tid, *settings.nice_value) != 0) {
+    TizenLog::Error("Could not set the nice value of %s: %s",
+                    thread.name.c_str(), strerror(errno));
+    result = false;
+  }
+  if (settings.name && *settings.name != thread.name) {
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/task/%d/comm", thread.tid);
+    FILE *file = fopen(path, "w");
+    bool renamed = false;
+    if (file) {
+      renamed = fputs(settings.name->c_str(), file) >= 0;
+      renamed &= fclose(file) == 0;
+    }
+    if (renamed) {
+      std::lock_guard<std::mutex> lock(g_renamed_threads_mutex);
+      g_renamed_threads[thread.tid] = thread.type;
+    } else {
+      TizenLog::Error("Could not rename %s.", thread.name.c_str());
+      result = false;
+    }
+  }
+  return result;
+}
+
+// Whether the process has the CAP_SYS_NICE capability, which allows
+// lowering nice values regardless of RLIMIT_NICE.
+bool HasSysNiceCapability() {
+  FILE *file = fopen("/proc/self/status", "r");
+  if (!file) {
+    return false;
+  }
+  unsigned long long capabilities = 0;
+  char line[256];
+  while (fgets(line, sizeof(line), file)) {
+    if (sscanf(line, "CapEff: %llx", &capabilities) == 1) {
+      break;
+    }
+  }
+  fclose(file);
+  constexpr int kCapSysNice = 23;
+  return (capabilities & (1ull << kCapSysNice)) != 0;
+}
+
+// Whether the nice value of a thread can be lowered back to |nice_value|
+// after it has been raised.
+bool CanRestoreNiceValue(int nice_value) {
+  static const bool has_sys_nice_capability = HasSysNiceCapability();
+  if (has_sys_nice_capability) {
+    return true;
+  }
+  struct rlimit limit;
+  if (getrlimit(RLIMIT_NICE, &limit) != 0) {
+    return false;
+  }
+  if (limit.rlim_cur == RLIM_INFINITY) {
+    return true;
+  }
+  // RLIMIT_NICE allows lowering the nice value down to 20 - rlim_cur.
+  return 20 - static_cast<int>(limit.rlim_cur) <= nice_value;
+}
+
+}  // namespace
+
+bool FlutterEngineThreadConfig::IsEmpty() const {
+  for (const FlutterEngineThreadSettings *settings :
+       {&platform, &ui, &raster, &io}) {
+    if (settings->cpu_affinity_mask || settings->nice_value ||
+        settings->realtime_priority || settings->name) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool FlutterEngineThreadConfig::Validate(std::string &error) const {
+  return ValidateSettings(platform, FlutterEngineThreadType::kPlatform,
+                          error) &&
+         ValidateSettings(ui, FlutterEngineThreadType::kUI, error) &&
+         ValidateSettings(raster, FlutterEngineThreadType::kRaster, error) &&
+         ValidateSettings(io, FlutterEngineThreadType::kIO, error);
+}
+
+std::vector<FlutterEngineThread> FlutterEngineThreads::Find() {
+  std::vector<FlutterEngineThread> threads;
+  DIR *dir = opendir("/proc/self/task");
+  if (!dir) {
+    TizenLog::Warn("Could not open /proc/self/task: %s", strerror(errno));
+    return threads;
+  }
+  pid_t pid = getpid();
+  std::lock_guard<std::mutex> lock(g_renamed_threads_mutex);
+  while (struct dirent *entry = readdir(dir)) {
+    pid_t tid = atoi(entry->d_name);
+    if (tid <= 0) {
+      continue;
+    }
+    std::string name = ReadThreadName(tid);
+    auto renamed = g_renamed_threads.find(tid);
+    if (renamed != g_renamed_threads.end()) {
+      threads.push_back({tid, renamed->second, name});
+    } else if (tid == pid) {
+      threads.push_back({tid, FlutterEngineThreadType::kPlatform, name});
+    } else if (EndsWith(name, ".ui")) {
+      threads.push_back({tid, FlutterEngineThreadType::kUI, name});
+    } else if (EndsWith(name, ".raster")) {
+      threads.push_back({tid, FlutterEngineThreadType::kRaster, name});
+    } else if (EndsWith(name, ".io")) {
+      threads.push_back({tid, FlutterEngineThreadType::kIO, name});
+    }
+  }
+  closedir(dir);
+  return threads;
+}
+
+bool FlutterEngineThreads::Apply(const FlutterEngineThreadConfig &config) {
+  bool result = true;
+  for (const FlutterEngineThread &thread : Find()) {
+    switch (thread.type) {
+      case FlutterEngineThreadType::kPlatform:
+        result &= ApplySettings(thread, config.platform);
+        break;
+      case FlutterEngineThreadType::kUI:
+        result &= ApplySettings(thread, config.ui);
+        break;
+      case FlutterEngineThreadType::kRaster:
+        result &= ApplySettings(thread, config.raster);
+        break;
+      case FlutterEngineThreadType::kIO:
+        result &= ApplySettings(thread, config.io);
+        break;
+    }
+  }
+  for (const FlutterEngineThreadPlacement &placement : GetPlacement()) {
+    TizenLog::Debug(
+        "Thread %s (%s, %d): affinity 0x%llx, last CPU %d, policy %d, nice "
+        "%d, priority %d",
+        placement.thread.name.c_str(),
+        GetThreadTypeName(placement.thread.type), placement.thread.tid,
+        static_cast<unsigned long long>(placement.cpu_affinity_mask),
+        placement.last_cpu, placement.policy, placement.nice_value,
+        placement.realtime_priority);
+  }
+  return result;
+}
+
+std::vector<FlutterEngineThreadPlacement>
+FlutterEngineThreads::GetPlacement() {
+  std::vector<FlutterEngineThreadPlacement> placements;
+  for (const FlutterEngineThread &thread : Find()) {
+    FlutterEngineThreadPlacement placement = {};
+    placement.thread = thread;
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (sched_getaffinity(thread.tid, sizeof(cpu_set), &cpu_set) == 0) {
+      for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &cpu_set)) {
+          placement.cpu_affinity_mask |= 1ull << cpu;
+        }
+      }
+    }
+    placement.last_cpu = ReadLastCpu(thread.tid);
+    placement.policy = sched_getscheduler(thread.tid);
+    placement.nice_value = getpriority(PRIO_PROCESS, thread.tid);
+    struct sched_param param = {};
+    if (sched_getparam(thread.tid, &param) == 0) {
+      placement.realtime_priority = param.sched_priority;
+    }
+    placements.push_back(placement);
+  }
+  return placements;
+}
+
+std::chrono::milliseconds FlutterEngineThreads::GetProcessCpuTime() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return std::chrono::milliseconds(0);
+  }
+  return std::chrono::milliseconds(
+      (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000 +
+      (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000);
+}
+
+bool FlutterEngineThrottler::IsSupported() {
+  // Engine threads inherit the nice value of the platform thread.
+  errno = 0;
+  int nice_value = getpriority(PRIO_PROCESS, 0);
+  return errno == 0 && CanRestoreNiceValue(nice_value);
+}
+
+void FlutterEngineThrottler::Throttle(int nice_value) {
+  if (is_throttled_) {
+    return;
+  }
+  is_throttled_ = true;
+  throttle_time_ = std::chrono::steady_clock::now();
+  throttle_cpu_time_ = FlutterEngineThreads::GetProcessCpuTime();
+
+  for (const FlutterEngineThread &thread : FlutterEngineThreads::Find()) {
+    if (thread.type == FlutterEngineThreadType::kPlatform) {
+      continue;
+    }
+    errno = 0;
+    int original = getpriority(PRIO_PROCESS, thread.tid);
+    if (errno != 0 || original >= nice_value) {
+      continue;
+    }
+    if (!CanRestoreNiceValue(original)) {
+      TizenLog::Debug("Not throttling %s: its priority could not be restored.",
+                      thread.name.c_str());
+      continue;
+    }
+    if (setpriority(PRIO_PROCESS, thread.tid, nice_value) == 0) {
+      original_nice_values_.emplace_back(thread.tid, original);
+    }
+  }
+}
+
+void FlutterEngineThrottler::Restore() {
+  if (!is_throttled_) {
+    return;
+  }
+  is_throttled_ = false;
+
+  auto start = std::chrono::steady_clock::now();
+  for (const auto &[tid, nice_value] : original_nice_values_) {
+    if (setpriority(PRIO_PROCESS, tid, nice_value) != 0 && errno != ESRCH) {
+      TizenLog::Warn("Could not restore the priority of thread %d: %s", tid,
+                     strerror(errno));
+    }
+  }
+  original_nice_values_.clear();
+  auto end = std::chrono::steady_clock::now();
+
+  last_pause_stats_.elapsed =
+      std::chrono::duration_cast<std::chrono::milliseconds>(end -
+                                                            throttle_time_);
+  last_pause_stats_.cpu_time =
+      FlutterEngineThreads::GetProcessCpuTime() - throttle_cpu_time_;
+  TizenLog::Info(
+      "Used %lld ms of CPU time in %lld ms while paused (%.1f%%). Restored "
+      "in %lld us.",
+      static_cast<long long>(last_pause_stats_.cpu_time.count()),
+      static_cast<long long>(last_pause_stats_.elapsed.count()),
+      last_pause_stats_.GetCpuUsage() * 100,
+      static_cast<long long>(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count()));
+}
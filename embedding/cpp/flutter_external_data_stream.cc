@@ -0,0 +1,265 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_external_data_stream.h"
+
+#include <dart_api_dl.h>
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#include "tizen_log.h"
+
+namespace {
+
+constexpr char kConnectChannel[] = "tizen/external_data";
+
+// The size of the API table address and the native port at the start of a
+// connection message.
+constexpr size_t kConnectHeaderSize = 16;
+
+// The streams registered with each messenger, by name.
+std::mutex g_streams_mutex;
+std::map<FlutterDesktopMessengerRef,
+         std::map<std::string, FlutterExternalDataStream*>>
+    g_streams;
+
+// Whether the Dart API table has been initialized in this process.
+bool g_is_api_initialized = false;
+
+// Whether all streams drop data.
+std::atomic<bool> g_is_paused{false};
+
+}  // namespace
+
+struct FlutterExternalDataStream::State {
+  std::string name;
+  size_t buffer_size = 0;
+  size_t buffer_count = 0;
+
+  // The memory of all buffers.
+  std::unique_ptr<uint8_t[]> memory;
+
+  // Whether each buffer is taken by the producer or held by Dart.
+  std::unique_ptr<std::atomic<bool>[]> in_use;
+
+  // The native port of the Dart side, or ILLEGAL_PORT if not connected.
+  std::atomic<Dart_Port> port{ILLEGAL_PORT};
+
+  std::atomic<uint64_t> posted{0};
+  std::atomic<uint64_t> dropped{0};
+};
+
+struct FlutterExternalDataStream::BufferPeer {
+  // Keeps the memory alive even if the stream is destroyed first.
+  std::shared_ptr<State> state;
+  size_t index;
+};
+
+std::unique_ptr<FlutterExternalDataStream> FlutterExternalDataStream::Create(
+    FlutterDesktopMessengerRef messenger, const std::string& name,
+    size_t buffer_size, size_t buffer_count) {
+  if (!messenger || buffer_size == 0 || buffer_count == 0) {
+    TizenLog::Error("Invalid external data stream parameters.");
+    return nullptr;
+  }
+  auto state = std::make_shared<State>();
+  state->name = name;
+  state->buffer_size = buffer_size;
+  state->buffer_count = buffer_count;
+  state->memory = std::make_unique<uint8_t[]>(buffer_size * buffer_count);
+  state->in_use = std::make_unique<std::atomic<bool>[]>(buffer_count);
+  for (size_t i = 0; i < buffer_count; i++) {
+    state->in_use[i].store(false);
+  }
+
+  std::lock_guard<std::mutex> lock(g_streams_mutex);
+  std::map<std::string, FlutterExternalDataStream*>& streams =
+      g_streams[messenger];
+  if (streams.find(name) != streams.end()) {
+    TizenLog::Error("An external data stream named %s already exists.",
+                    name.c_str());
+    return nullptr;
+  }
+  if (streams.empty()) {
+    FlutterDesktopMessengerSetCallback(messenger, kConnectChannel,
+                                       OnConnectMessage, nullptr);
+  }
+  auto* stream = new FlutterExternalDataStream(messenger, std::move(state));
+  streams[name] = stream;
+  return std::unique_ptr<FlutterExternalDataStream>(stream);
+}
+
+FlutterExternalDataStream::FlutterExternalDataStream(
+    FlutterDesktopMessengerRef messenger, std::shared_ptr<State> state)
+    : messenger_(messenger), state_(std::move(state)) {
+  // The engine may be destroyed before this stream. The reference also
+  // keeps |messenger_| from being reused as a key of |g_streams| by another
+  // engine while this stream is registered.
+  FlutterDesktopMessengerAddRef(messenger_);
+}
+
+FlutterExternalDataStream::~FlutterExternalDataStream() {
+  state_->port.store(ILLEGAL_PORT);
+
+  bool is_last_stream = false;
+  {
+    std::lock_guard<std::mutex> lock(g_streams_mutex);
+    auto streams = g_streams.find(messenger_);
+    if (streams != g_streams.end()) {
+      streams->second.erase(state_->name);
+      if (streams->second.empty()) {
+        g_streams.erase(streams);
+        is_last_stream = true;
+      }
+    }
+  }
+  FlutterDesktopMessengerLock(messenger_);
+  if (is_last_stream && FlutterDesktopMessengerIsAvailable(messenger_)) {
+    FlutterDesktopMessengerSetCallback(messenger_, kConnectChannel, nullptr,
+                                       nullptr);
+  }
+  FlutterDesktopMessengerUnlock(messenger_);
+  FlutterDesktopMessengerRelease(messenger_);
+}
+
+void FlutterExternalDataStream::SetPaused(bool paused) {
+  g_is_paused.store(paused);
+}
+
+bool FlutterExternalDataStream::IsConnected() const {
+  return state_->port.load() != ILLEGAL_PORT;
+}
+
+size_t FlutterExternalDataStream::GetBufferSize() const {
+  return state_->buffer_size;
+}
+
+uint8_t* FlutterExternalDataStream::AcquireBuffer() {
+  if (!IsConnected()) {
+    return nullptr;
+  }
+  if (g_is_paused.load(std::memory_order_relaxed)) {
+    state_->dropped++;
+    return nullptr;
+  }
+  for (size_t i = 0; i < state_->buffer_count; i++) {
+    bool expected = false;
+    if (state_->in_use[i].compare_exchange_strong(expected, true,
+                                                  std::memory_order_acquire)) {
+      return state_->memory.get() + i * state_->buffer_size;
+    }
+  }
+  state_->dropped++;
+  return nullptr;
+}
+
+void FlutterExternalDataStream::ReleaseBuffer(uint8_t* buffer) {
+  int index = GetBufferIndex(buffer);
+  if (index < 0) {
+    TizenLog::Error("The buffer does not belong to %s.",
+                    state_->name.c_str());
+    return;
+  }
+  state_->in_use[index].store(false, std::memory_order_release);
+}
+
+bool FlutterExternalDataStream::Post(uint8_t* buffer, size_t size) {
+  int index = GetBufferIndex(buffer);
+  if (index < 0 || size > state_->buffer_size) {
+    TizenLog::Error("Invalid buffer posted to %s.", state_->name.c_str());
+    return false;
+  }
+  Dart_Port port = state_->port.load();
+  if (port == ILLEGAL_PORT) {
+    ReleaseBuffer(buffer);
+    return false;
+  }
+
+  auto* peer = new BufferPeer{state_, static_cast<size_t>(index)};
+  Dart_CObject object;
+  object.type = Dart_CObject_kExternalTypedData;
+  object.value.as_external_typed_data.type = Dart_TypedData_kUint8;
+  object.value.as_external_typed_data.length = size;
+  object.value.as_external_typed_data.data = buffer;
+  object.value.as_external_typed_data.peer = peer;
+  object.value.as_external_typed_data.callback = OnBufferFinalized;
+  if (!Dart_PostCObject_DL(port, &object)) {
+    // The buffer is still owned by this stream if the message was not
+    // enqueued.
+    delete peer;
+    ReleaseBuffer(buffer);
+    return false;
+  }
+  state_->posted++;
+  return true;
+}
+
+FlutterExternalDataStream::Stats FlutterExternalDataStream::GetStats() const {
+  Stats stats;
+  stats.posted = state_->posted.load();
+  stats.dropped = state_->dropped.load();
+  return stats;
+}
+
+int FlutterExternalDataStream::GetBufferIndex(const uint8_t* buffer) const {
+  const uint8_t* memory = state_->memory.get();
+  if (buffer < memory ||
+      buffer >= memory + state_->buffer_size * state_->buffer_count ||
+      (buffer - memory) % state_->buffer_size != 0) {
+    return -1;
+  }
+  return static_cast<int>((buffer - memory) / state_->buffer_size);
+}
+
+void FlutterExternalDataStream::OnBufferFinalized(void* isolate_callback_data,
+                                                  void* peer) {
+  auto* buffer_peer = static_cast<BufferPeer*>(peer);
+  buffer_peer->state->in_use[buffer_peer->index].store(
+      false, std::memory_order_release);
+  delete buffer_peer;
+}
+
+void FlutterExternalDataStream::OnConnectMessage(
+    FlutterDesktopMessengerRef messenger, const FlutterDesktopMessage* message,
+    void* user_data) {
+  FlutterDesktopMessengerSendResponse(messenger, message->response_handle,
+                                      nullptr, 0);
+  if (message->message_size < kConnectHeaderSize) {
+    TizenLog::Error("Invalid message on %s.", kConnectChannel);
+    return;
+  }
+  int64_t api_data = 0;
+  Dart_Port port = ILLEGAL_PORT;
+  memcpy(&api_data, message->message, sizeof(api_data));
+  memcpy(&port, message->message + sizeof(api_data), sizeof(port));
+  std::string name(
+      reinterpret_cast<const char*>(message->message) + kConnectHeaderSize,
+      message->message_size - kConnectHeaderSize);
+
+  // The API table is the same for all isolates in the process.
+  if (!g_is_api_initialized) {
+    if (Dart_InitializeApiDL(reinterpret_cast<void*>(api_data)) != 0) {
+      TizenLog::Error("Could not initialize the Dart API.");
+      return;
+    }
+    g_is_api_initialized = true;
+  }
+
+  std::lock_guard<std::mutex> lock(g_streams_mutex);
+  auto streams = g_streams.find(messenger);
+  if (streams == g_streams.end()) {
+    return;
+  }
+  auto stream = streams->second.find(name);
+  if (stream == streams->second.end()) {
+    TizenLog::Warn("No external data stream named %s.", name.c_str());
+    return;
+  }
+  stream->second->state_->port.store(port);
+  TizenLog::Debug("External data stream %s %s.", name.c_str(),
+                  port == ILLEGAL_PORT ? "disconnected" : "connected");
+}
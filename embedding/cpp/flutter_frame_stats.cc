@@ -0,0 +1,172 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_frame_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "include/flutter_standard_message.h"
+#include "tizen_log.h"
+
+namespace {
+
+constexpr char kChannel[] = "tizen/frame_timing";
+
+// The number of values sent for each frame.
+constexpr size_t kValuesPerFrame = 3;
+
+const char *GetSegmentName(FlutterFrameStats::Segment segment) {
+  return segment == FlutterFrameStats::Segment::kLifetime ? "since launch"
+                                                          : "since resume";
+}
+
+}  // namespace
+
+FlutterFrameStats::FlutterFrameStats(FlutterDesktopMessengerRef messenger,
+                                     int64_t frame_budget_us)
+    : messenger_(messenger), frame_budget_us_(frame_budget_us) {
+  FlutterDesktopMessengerSetCallback(messenger_, kChannel, OnMessage, this);
+}
+
+FlutterFrameStats::~FlutterFrameStats() {
+  SetLogInterval(0.0);
+  FlutterDesktopMessengerSetCallback(messenger_, kChannel, nullptr, nullptr);
+}
+
+void FlutterFrameStats::AddFrame(int64_t build_us, int64_t raster_us,
+                                 int64_t total_us) {
+  bool is_janky = build_us > frame_budget_us_ || raster_us > frame_budget_us_;
+  bool is_vsync_overrun = total_us > frame_budget_us_;
+  for (SegmentStats *stats : {&lifetime_, &current_}) {
+    AddToHistogram(stats->histograms[static_cast<size_t>(Phase::kBuild)],
+                   build_us);
+    AddToHistogram(stats->histograms[static_cast<size_t>(Phase::kRaster)],
+                   raster_us);
+    AddToHistogram(stats->histograms[static_cast<size_t>(Phase::kTotal)],
+                   total_us);
+    stats->frame_count++;
+    if (is_janky) {
+      stats->jank_count++;
+    }
+    if (is_vsync_overrun) {
+      stats->vsync_overrun_count++;
+    }
+  }
+}
+
+void FlutterFrameStats::StartSegment() {
+  current_ = SegmentStats();
+  last_logged_frame_count_ = 0;
+}
+
+double FlutterFrameStats::GetPercentile(Phase phase, double percentile,
+                                        Segment segment) const {
+  const SegmentStats &stats = GetSegment(segment);
+  if (stats.frame_count == 0) {
+    return 0.0;
+  }
+  const Histogram &histogram = stats.histograms[static_cast<size_t>(phase)];
+  percentile = std::clamp(percentile, 0.0, 100.0);
+  uint64_t rank = std::max<uint64_t>(
+      static_cast<uint64_t>(std::ceil(percentile / 100 * stats.frame_count)),
+      1);
+
+  uint64_t count = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    count += histogram.buckets[i];
+    if (count >= rank) {
+      if (i == kBucketCount - 1) {
+        break;
+      }
+      int64_t upper_bound = static_cast<int64_t>(i + 1) * kBucketWidthUs;
+      return std::min(upper_bound, histogram.max_us) / 1000.0;
+    }
+  }
+  return histogram.max_us / 1000.0;
+}
+
+uint64_t FlutterFrameStats::GetFrameCount(Segment segment) const {
+  return GetSegment(segment).frame_count;
+}
+
+uint64_t FlutterFrameStats::GetJankCount(Segment segment) const {
+  return GetSegment(segment).jank_count;
+}
+
+uint64_t FlutterFrameStats::GetVsyncOverrunCount(Segment segment) const {
+  return GetSegment(segment).vsync_overrun_count;
+}
+
+void FlutterFrameStats::SetLogInterval(double interval_seconds) {
+  if (log_timer_) {
+    ecore_timer_del(log_timer_);
+    log_timer_ = nullptr;
+  }
+  if (interval_seconds > 0.0) {
+    last_logged_frame_count_ = current_.frame_count;
+    log_timer_ = ecore_timer_add(interval_seconds, OnLogTimer, this);
+  }
+}
+
+void FlutterFrameStats::LogSummary(Segment segment) const {
+  const SegmentStats &stats = GetSegment(segment);
+  TizenLog::Info(
+      "%llu frames %s: %llu janky, %llu vsync overruns, build "
+      "p50/p90/p99 %.1f/%.1f/%.1f ms, raster p50/p90/p99 %.1f/%.1f/%.1f ms.",
+      static_cast<unsigned long long>(stats.frame_count),
+      GetSegmentName(segment),
+      static_cast<unsigned long long>(stats.jank_count),
+      static_cast<unsigned long long>(stats.vsync_overrun_count),
+      GetPercentile(Phase::kBuild, 50, segment),
+      GetPercentile(Phase::kBuild, 90, segment),
+      GetPercentile(Phase::kBuild, 99, segment),
+      GetPercentile(Phase::kRaster, 50, segment),
+      GetPercentile(Phase::kRaster, 90, segment),
+      GetPercentile(Phase::kRaster, 99, segment));
+}
+
+void FlutterFrameStats::AddToHistogram(Histogram &histogram,
+                                       int64_t duration_us) {
+  duration_us = std::max<int64_t>(duration_us, 0);
+  size_t index = std::min(static_cast<size_t>(duration_us / kBucketWidthUs),
+                          kBucketCount - 1);
+  histogram.buckets[index]++;
+  histogram.max_us = std::max(histogram.max_us, duration_us);
+}
+
+const FlutterFrameStats::SegmentStats &FlutterFrameStats::GetSegment(
+    Segment segment) const {
+  return segment == Segment::kLifetime ? lifetime_ : current_;
+}
+
+void FlutterFrameStats::OnMessage(FlutterDesktopMessengerRef messenger,
+                                  const FlutterDesktopMessage *message,
+                                  void *user_data) {
+  FlutterDesktopMessengerSendResponse(messenger, message->response_handle,
+                                      nullptr, 0);
+  auto *self = static_cast<FlutterFrameStats *>(user_data);
+  FlutterStandardMessageReader reader(message->message, message->message_size);
+  FlutterStandardValue value;
+  if (!reader.Read(value) || value.type != FlutterStandardType::kInt64List ||
+      value.length % kValuesPerFrame != 0) {
+    TizenLog::Error("Invalid message on %s.", kChannel);
+    return;
+  }
+  for (size_t i = 0; i < value.length; i += kValuesPerFrame) {
+    int64_t values[kValuesPerFrame];
+    memcpy(values, value.data + i * sizeof(int64_t), sizeof(values));
+    self->AddFrame(values[0], values[1], values[2]);
+  }
+}
+
+Eina_Bool FlutterFrameStats::OnLogTimer(void *data) {
+  auto *self = static_cast<FlutterFrameStats *>(data);
+  if (self->current_.frame_count != self->last_logged_frame_count_) {
+    self->last_logged_frame_count_ = self->current_.frame_count;
+    self->LogSummary(Segment::kCurrent);
+  }
+  return ECORE_CALLBACK_RENEW;
+}
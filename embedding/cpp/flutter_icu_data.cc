@@ -0,0 +1,239 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_icu_data.h"
+
+#include <app_common.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <map>
+
+#include "include/flutter_trace.h"
+#include "tizen_log.h"
+
+namespace {
+
+constexpr char kCacheFileName[] = "flutter_icu_data_cache";
+
+// The directories searched for shared ICU data, in order of preference.
+const char* const kSharedDirectories[] = {
+    "/usr/share/flutter",
+    "/opt/usr/share/flutter",
+};
+
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+// A checksum of a file cached along with the state of the file.
+struct CacheEntry {
+  int64_t size;
+  int64_t modification_time;
+  uint64_t checksum;
+};
+
+std::map<std::string, CacheEntry> ReadCache(const std::string& cache_path) {
+  std::map<std::string, CacheEntry> cache;
+  FILE* file = fopen(cache_path.c_str(), "r");
+  if (!file) {
+    return cache;
+  }
+  char* line = nullptr;
+  size_t line_length = 0;
+  ssize_t length;
+  while ((length = getline(&line, &line_length, file)) > 0) {
+    if (line[length - 1] == '\n') {
+      line[length - 1] = '\0';
+    }
+    long long size, modification_time;
+    uint64_t checksum;
+    int path_offset = 0;
+    if (sscanf(line, "%lld %lld %" SCNx64 " %n", &size, &modification_time,
+               &checksum, &path_offset) == 3 &&
+        path_offset > 0) {
+      cache[line + path_offset] = {size, modification_time, checksum};
+    }
+  }
+  free(line);
+  fclose(file);
+  return cache;
+}
+
+void WriteCache(const std::string& cache_path,
+                const std::map<std::string, CacheEntry>& cache) {
+  std::string temp_path = cache_path + ".tmp";
+  FILE* file = fopen(temp_path.c_str(), "w");
+  if (!file) {
+    return;
+  }
+  for (const auto& [path, entry] : cache) {
+    fprintf(file, "%lld %lld %016" PRIx64 " %s\n",
+            static_cast<long long>(entry.size),
+            static_cast<long long>(entry.modification_time), entry.checksum,
+            path.c_str());
+  }
+  if (fclose(file) != 0 || rename(temp_path.c_str(), cache_path.c_str()) != 0) {
+    remove(temp_path.c_str());
+  }
+}
+
+// Whether any of |directories| has a shared ICU data file of |size| bytes.
+//
+// This is checked before the bundled file is read to compute its checksum,
+// since most devices have no shared ICU data.
+bool HasSharedFileOfSize(const std::vector<std::string>& directories,
+                         int64_t size) {
+  for (const std::string& directory : directories) {
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+      continue;
+    }
+    bool found = false;
+    while (struct dirent* entry = readdir(dir)) {
+      size_t length = strlen(entry->d_name);
+      if (strncmp(entry->d_name, "icudtl-", 7) != 0 || length < 11 ||
+          strcmp(entry->d_name + length - 4, ".dat") != 0) {
+        continue;
+      }
+      struct stat file_stat;
+      std::string path = directory + "/" + entry->d_name;
+      if (stat(path.c_str(), &file_stat) == 0 && file_stat.st_size == size) {
+        found = true;
+        break;
+      }
+    }
+    closedir(dir);
+    if (found) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns the checksum of the file at |path| from |cache|, computing and
+// caching it if missing or out of date. Returns 0 if the file cannot be
+// read.
+uint64_t GetChecksum(const std::string& path, const struct stat& file_stat,
+                     std::map<std::string, CacheEntry>& cache,
+                     bool& is_cache_changed) {
+  auto iter = cache.find(path);
+  if (iter != cache.end() && iter->second.size == file_stat.st_size &&
+      iter->second.modification_time == file_stat.st_mtime) {
+    return iter->second.checksum;
+  }
+  uint64_t checksum = FlutterIcuData::ComputeChecksum(path);
+  if (checksum != 0) {
+    cache[path] = {file_stat.st_size, file_stat.st_mtime, checksum};
+    is_cache_changed = true;
+  }
+  return checksum;
+}
+
+}  // namespace
+
+std::string FlutterIcuData::Resolve(const std::string& bundled_path) {
+  std::string cache_path;
+  char* data_path = app_get_data_path();
+  if (data_path) {
+    cache_path = std::string(data_path) + kCacheFileName;
+    free(data_path);
+  }
+  return Resolve(bundled_path,
+                 std::vector<std::string>(std::begin(kSharedDirectories),
+                                          std::end(kSharedDirectories)),
+                 cache_path);
+}
+
+std::string FlutterIcuData::Resolve(
+    const std::string& bundled_path,
+    const std::vector<std::string>& shared_directories,
+    const std::string& cache_path) {
+  FLUTTER_TRACE_SCOPE("FlutterIcuData::Resolve");
+  struct stat bundled_stat;
+  if (stat(bundled_path.c_str(), &bundled_stat) != 0 ||
+      !HasSharedFileOfSize(shared_directories, bundled_stat.st_size)) {
+    return bundled_path;
+  }
+
+  std::map<std::string, CacheEntry> cache;
+  if (!cache_path.empty()) {
+    cache = ReadCache(cache_path);
+  }
+  bool is_cache_changed = false;
+  std::string result = bundled_path;
+
+  uint64_t checksum =
+      GetChecksum(bundled_path, bundled_stat, cache, is_cache_changed);
+  if (checksum != 0) {
+    char file_name[32];
+    snprintf(file_name, sizeof(file_name), "icudtl-%016" PRIx64 ".dat",
+             checksum);
+    for (const std::string& directory : shared_directories) {
+      std::string shared_path = directory + "/" + file_name;
+      struct stat shared_stat;
+      if (stat(shared_path.c_str(), &shared_stat) != 0 ||
+          shared_stat.st_size != bundled_stat.st_size) {
+        continue;
+      }
+      // The name alone is not trusted, since the file may be corrupted or
+      // only partially installed.
+      if (GetChecksum(shared_path, shared_stat, cache, is_cache_changed) ==
+          checksum) {
+        result = shared_path;
+        break;
+      }
+      TizenLog::Warn("The checksum of %s does not match.", shared_path.c_str());
+    }
+  }
+
+  if (is_cache_changed && !cache_path.empty()) {
+    WriteCache(cache_path, cache);
+  }
+  if (result != bundled_path) {
+    TizenLog::Info("Using the shared ICU data: %s", result.c_str());
+    // Drop the pages of the bundled file which may have been read to compute
+    // its checksum.
+    int fd = open(bundled_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+      posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+      close(fd);
+    }
+  }
+  return result;
+}
+
+uint64_t FlutterIcuData::ComputeChecksum(const std::string& path) {
+  FLUTTER_TRACE_SCOPE("FlutterIcuData::ComputeChecksum");
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return 0;
+  }
+  // The file is read once from start to end.
+  posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  // 64-bit FNV-1a. This detects corrupted files and different versions of
+  // the data, but is not meant to resist deliberate tampering. The shared
+  // directories are only writable by the platform.
+  uint64_t hash = kFnvOffsetBasis;
+  uint8_t buffer[64 * 1024];
+  ssize_t length;
+  while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+    for (ssize_t i = 0; i < length; i++) {
+      hash ^= buffer[i];
+      hash *= kFnvPrime;
+    }
+  }
+  close(fd);
+  if (length < 0) {
+    return 0;
+  }
+  return hash;
+}
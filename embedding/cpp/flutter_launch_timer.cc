@@ -0,0 +1,92 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_launch_timer.h"
+
+#include <bundle.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+#include "include/flutter_page_cache.h"
+#include "tizen_log.h"
+
+namespace {
+
+constexpr char kAotLibraryPath[] = "../lib/libapp.so";
+
+// The key of the launch bundle which AUL sets to the time when the launch
+// request was sent, as "seconds/microseconds" since the epoch.
+constexpr char kStartTimeKey[] = "__AUL_STARTTIME__";
+
+// The fraction of the AOT library that must be cached for a launch to be
+// considered warm.
+constexpr double kWarmCachedRatio = 0.9;
+
+// Returns the time since the epoch in milliseconds.
+int64_t GetRealTimeMilliseconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_REALTIME, &now);
+  return static_cast<int64_t>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+}
+
+// Returns the time when the launch request was sent in milliseconds since
+// the epoch, or -1 if not found in the launch bundle.
+int64_t GetLaunchRequestTimeMilliseconds(int argc, char **argv) {
+  bundle *launch_bundle = bundle_import_from_argv(argc, argv);
+  if (!launch_bundle) {
+    return -1;
+  }
+  int64_t result = -1;
+  char *value = nullptr;
+  long long seconds, microseconds;
+  if (bundle_get_str(launch_bundle, kStartTimeKey, &value) ==
+          BUNDLE_ERROR_NONE &&
+      sscanf(value, "%lld/%lld", &seconds, &microseconds) == 2) {
+    result = seconds * 1000 + microseconds / 1000;
+  }
+  bundle_free(launch_bundle);
+  return result;
+}
+
+}  // namespace
+
+void FlutterLaunchTimer::Start(int argc, char **argv) {
+  start_time_ = GetLaunchRequestTimeMilliseconds(argc, argv);
+  result_.is_from_launch_request = start_time_ >= 0;
+  if (!result_.is_from_launch_request) {
+    start_time_ = GetRealTimeMilliseconds();
+  }
+  result_.cached_ratio = FlutterPageCache::GetCachedRatio(kAotLibraryPath);
+  result_.is_warm = result_.cached_ratio >= kWarmCachedRatio;
+}
+
+void FlutterLaunchTimer::MarkCreated() {
+  result_.create_milliseconds = GetRealTimeMilliseconds() - start_time_;
+}
+
+void FlutterLaunchTimer::Finish() {
+  if (is_finished_) {
+    return;
+  }
+  is_finished_ = true;
+  result_.launch_milliseconds = GetRealTimeMilliseconds() - start_time_;
+  const char *origin =
+      result_.is_from_launch_request ? "the launch request" : "Run";
+  if (result_.cached_ratio < 0.0) {
+    TizenLog::Info(
+        "The launch took %lld ms from %s (OnCreate done at %lld ms).",
+        static_cast<long long>(result_.launch_milliseconds), origin,
+        static_cast<long long>(result_.create_milliseconds));
+    return;
+  }
+  TizenLog::Info(
+      "The %s launch took %lld ms from %s (OnCreate done at %lld ms, %.0f%% "
+      "of the AOT library cached).",
+      result_.is_warm ? "warm" : "cold",
+      static_cast<long long>(result_.launch_milliseconds), origin,
+      static_cast<long long>(result_.create_milliseconds),
+      result_.cached_ratio * 100);
+}
@@ -0,0 +1,123 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_memory_pressure.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "include/flutter_trace.h"
+#include "tizen_log.h"
+
+namespace {
+
+struct ReclaimCallbackEntry {
+  int id;
+  std::string name;
+  int priority;
+  FlutterMemoryPressureLevel min_level;
+  FlutterMemoryPressure::ReclaimCallback callback;
+};
+
+std::mutex g_callbacks_mutex;
+std::vector<ReclaimCallbackEntry> g_callbacks;
+int g_next_callback_id = 1;
+
+const char *GetLevelName(FlutterMemoryPressureLevel level) {
+  switch (level) {
+    case FlutterMemoryPressureLevel::kNormal:
+      return "normal";
+    case FlutterMemoryPressureLevel::kSoft:
+      return "soft";
+    case FlutterMemoryPressureLevel::kHard:
+      return "hard";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+FlutterMemoryPressureLevel FlutterMemoryPressure::GetLevel(
+    app_event_info_h event_info) {
+  app_event_low_memory_status_e status;
+  if (!event_info ||
+      app_event_get_low_memory_status(event_info, &status) != APP_ERROR_NONE) {
+    // Assume the worst if the status is unknown.
+    return FlutterMemoryPressureLevel::kHard;
+  }
+  switch (status) {
+    case APP_EVENT_LOW_MEMORY_NORMAL:
+      return FlutterMemoryPressureLevel::kNormal;
+    case APP_EVENT_LOW_MEMORY_SOFT_WARNING:
+      return FlutterMemoryPressureLevel::kSoft;
+    default:
+      return FlutterMemoryPressureLevel::kHard;
+  }
+}
+
+int FlutterMemoryPressure::AddReclaimCallback(
+    const std::string &name, int priority, FlutterMemoryPressureLevel min_level,
+    ReclaimCallback callback) {
+  std::lock_guard<std::mutex> lock(g_callbacks_mutex);
+  int id = g_next_callback_id++;
+  ReclaimCallbackEntry entry = {id, name, priority, min_level,
+                                std::move(callback)};
+  auto it = std::upper_bound(g_callbacks.begin(), g_callbacks.end(), entry,
+                             [](const ReclaimCallbackEntry &a,
+                                const ReclaimCallbackEntry &b) {
+                               return a.priority < b.priority;
+                             });
+  g_callbacks.insert(it, std::move(entry));
+  return id;
+}
+
+void FlutterMemoryPressure::RemoveReclaimCallback(int id) {
+  std::lock_guard<std::mutex> lock(g_callbacks_mutex);
+  g_callbacks.erase(
+      std::remove_if(g_callbacks.begin(), g_callbacks.end(),
+                     [id](const ReclaimCallbackEntry &entry) {
+                       return entry.id == id;
+                     }),
+      g_callbacks.end());
+}
+
+void FlutterMemoryPressure::Reclaim(FlutterMemoryPressureLevel level,
+                                    const std::vector<FlutterEngine *> &engines,
+                                    FlutterEnginePool *pool) {
+  FLUTTER_TRACE_SCOPE("FlutterMemoryPressure::Reclaim");
+  if (level == FlutterMemoryPressureLevel::kNormal) {
+    return;
+  }
+
+  // Make a copy so that callbacks can be added or removed while running.
+  std::vector<ReclaimCallbackEntry> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(g_callbacks_mutex);
+    callbacks = g_callbacks;
+  }
+
+  // Purges the image and raster caches and lets the Dart VM collect garbage.
+  for (FlutterEngine *engine : engines) {
+    engine->NotifyLowMemoryWarning();
+  }
+
+  size_t spare_count = 0;
+  if (level == FlutterMemoryPressureLevel::kHard && pool) {
+    spare_count = pool->GetSpareCount() + pool->GetRunningSpareCount();
+    pool->Clear();
+  }
+
+  size_t callback_count = 0;
+  for (const ReclaimCallbackEntry &entry : callbacks) {
+    if (level >= entry.min_level) {
+      entry.callback(level);
+      callback_count++;
+    }
+  }
+
+  TizenLog::Info(
+      "Reclaimed memory (%s memory pressure): purged %zu engines, released "
+      "%zu spare engines, ran %zu callbacks.",
+      GetLevelName(level), engines.size(), spare_count, callback_count);
+}
@@ -0,0 +1,273 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_memory_stats.h"
+
+#include <app_common.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include "include/flutter_standard_message.h"
+#include "include/flutter_trace.h"
+#include "tizen_log.h"
+
+namespace {
+
+constexpr char kChannel[] = "tizen/memory_usage";
+
+// The name prefixes of mappings of GPU memory, which depend on the driver.
+const char* const kGpuMappingPrefixes[] = {
+    "/dev/dri/",      "/dev/mali",         "/dev/kgsl",
+    "/dev/dma_heap/", "anon_inode:dmabuf", "/dmabuf",
+};
+
+bool StartsWith(const char* value, const char* prefix) {
+  return strncmp(value, prefix, strlen(prefix)) == 0;
+}
+
+bool EndsWith(const char* value, size_t length, const char* suffix) {
+  size_t suffix_length = strlen(suffix);
+  return length >= suffix_length &&
+         strcmp(value + length - suffix_length, suffix) == 0;
+}
+
+// Returns the category of |usage| which a mapping named |name| belongs to.
+int64_t& GetCategory(const char* name, const std::string& plugin_directory,
+                     FlutterMemoryUsage& usage) {
+  size_t length = strlen(name);
+  if (length == 0 || strcmp(name, "[heap]") == 0) {
+    return usage.native_heap;
+  }
+  if (name[0] == '[') {
+    // The Dart VM names its heap "dart-heap" and other regions "dart-*".
+    if (StartsWith(name, "[anon:dart-")) {
+      return usage.dart_heap;
+    }
+    if (StartsWith(name, "[anon:")) {
+      return usage.native_heap;
+    }
+    // e.g. [stack] and [vdso].
+    return usage.other;
+  }
+  for (const char* prefix : kGpuMappingPrefixes) {
+    if (StartsWith(name, prefix)) {
+      return usage.gpu;
+    }
+  }
+  const char* base_name = strrchr(name, '/');
+  base_name = base_name ? base_name + 1 : name;
+  if (strcmp(base_name, "libapp.so") == 0) {
+    return usage.aot_library;
+  }
+  if (StartsWith(base_name, "icudtl")) {
+    return usage.icu_data;
+  }
+  if (StartsWith(base_name, "libflutter_engine.so") ||
+      StartsWith(base_name, "libflutter_tizen")) {
+    return usage.engine_library;
+  }
+  if (!plugin_directory.empty() && StartsWith(name, plugin_directory.c_str()) &&
+      (EndsWith(name, length, ".so") || strstr(name, ".so.") != nullptr)) {
+    return usage.plugin_libraries;
+  }
+  return usage.other;
+}
+
+// Returns the directory of the shared libraries bundled with the app.
+std::string GetPluginDirectory() {
+  char* resource_path = app_get_resource_path();
+  if (!resource_path) {
+    return "";
+  }
+  std::string lib_path = std::string(resource_path) + "../lib";
+  free(resource_path);
+  // Mappings are named by their canonical paths.
+  char* real_path = realpath(lib_path.c_str(), nullptr);
+  if (!real_path) {
+    return "";
+  }
+  std::string result = std::string(real_path) + "/";
+  free(real_path);
+  return result;
+}
+
+int64_t GetMonotonicTimeMilliseconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<int64_t>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+}
+
+long long ToKiB(int64_t bytes) {
+  return static_cast<long long>(bytes / 1024);
+}
+
+}  // namespace
+
+FlutterMemoryStats::FlutterMemoryStats(FlutterDesktopMessengerRef messenger,
+                                       size_t capacity,
+                                       const std::string& proc_path)
+    : messenger_(messenger),
+      proc_path_(proc_path),
+      plugin_directory_(GetPluginDirectory()),
+      capacity_(capacity > 0 ? capacity : 1) {
+  samples_.reserve(capacity_);
+  if (messenger_) {
+    // The engine may be destroyed by its view before this instance.
+    FlutterDesktopMessengerAddRef(messenger_);
+    FlutterDesktopMessengerSetCallback(messenger_, kChannel, OnMessage, this);
+  }
+}
+
+FlutterMemoryStats::~FlutterMemoryStats() {
+  SetRecordInterval(0.0);
+  if (messenger_) {
+    FlutterDesktopMessengerLock(messenger_);
+    if (FlutterDesktopMessengerIsAvailable(messenger_)) {
+      FlutterDesktopMessengerSetCallback(messenger_, kChannel, nullptr,
+                                         nullptr);
+    }
+    FlutterDesktopMessengerUnlock(messenger_);
+    FlutterDesktopMessengerRelease(messenger_);
+  }
+}
+
+FlutterMemoryUsage FlutterMemoryStats::Sample() const {
+  FLUTTER_TRACE_SCOPE("FlutterMemoryStats::Sample");
+  FlutterMemoryUsage usage;
+  if (!ReadSmaps(proc_path_ + "/smaps", plugin_directory_, usage)) {
+    TizenLog::Error("Could not read %s/smaps.", proc_path_.c_str());
+  }
+  usage.timestamp_ms = GetMonotonicTimeMilliseconds();
+  usage.image_cache = image_cache_;
+  return usage;
+}
+
+FlutterMemoryUsage FlutterMemoryStats::Record() {
+  FlutterMemoryUsage usage = Sample();
+  if (samples_.size() < capacity_) {
+    samples_.push_back(usage);
+  } else {
+    samples_[oldest_index_] = usage;
+    oldest_index_ = (oldest_index_ + 1) % capacity_;
+  }
+  return usage;
+}
+
+void FlutterMemoryStats::SetRecordInterval(double interval_seconds) {
+  if (record_timer_) {
+    ecore_timer_del(record_timer_);
+    record_timer_ = nullptr;
+  }
+  if (interval_seconds > 0.0) {
+    record_timer_ = ecore_timer_add(interval_seconds, OnRecordTimer, this);
+  }
+}
+
+std::vector<FlutterMemoryUsage> FlutterMemoryStats::GetTimeSeries() const {
+  std::vector<FlutterMemoryUsage> result;
+  result.reserve(samples_.size());
+  for (size_t i = 0; i < samples_.size(); i++) {
+    result.push_back(samples_[(oldest_index_ + i) % samples_.size()]);
+  }
+  return result;
+}
+
+std::string FlutterMemoryStats::ExportTimeSeries() const {
+  std::string result =
+      "# time total dart gpu aot icu engine plugins native other images\n";
+  char line[256];
+  for (const FlutterMemoryUsage& usage : GetTimeSeries()) {
+    snprintf(line, sizeof(line),
+             "%lld %lld %lld %lld %lld %lld %lld %lld %lld %lld %lld\n",
+             static_cast<long long>(usage.timestamp_ms), ToKiB(usage.total),
+             ToKiB(usage.dart_heap), ToKiB(usage.gpu),
+             ToKiB(usage.aot_library), ToKiB(usage.icu_data),
+             ToKiB(usage.engine_library), ToKiB(usage.plugin_libraries),
+             ToKiB(usage.native_heap), ToKiB(usage.other),
+             usage.image_cache < 0 ? -1 : ToKiB(usage.image_cache));
+    result += line;
+  }
+  return result;
+}
+
+void FlutterMemoryStats::Log(const FlutterMemoryUsage& usage) {
+  TizenLog::Info(
+      "Memory usage: %lld KiB in total, Dart heap %lld KiB, GPU %lld KiB, "
+      "AOT library %lld KiB, ICU data %lld KiB, engine %lld KiB, plugins "
+      "%lld KiB, native heap %lld KiB, other %lld KiB.",
+      ToKiB(usage.total), ToKiB(usage.dart_heap), ToKiB(usage.gpu),
+      ToKiB(usage.aot_library), ToKiB(usage.icu_data),
+      ToKiB(usage.engine_library), ToKiB(usage.plugin_libraries),
+      ToKiB(usage.native_heap), ToKiB(usage.other));
+  if (usage.image_cache >= 0) {
+    TizenLog::Info("The image cache holds %lld KiB.",
+                   ToKiB(usage.image_cache));
+  }
+}
+
+bool FlutterMemoryStats::ReadSmaps(const std::string& smaps_path,
+                                   const std::string& plugin_directory,
+                                   FlutterMemoryUsage& usage) {
+  FILE* file = fopen(smaps_path.c_str(), "r");
+  if (!file) {
+    return false;
+  }
+  // The category of the current mapping.
+  int64_t* category = &usage.other;
+  char* line = nullptr;
+  size_t line_length = 0;
+  ssize_t length;
+  while ((length = getline(&line, &line_length, file)) > 0) {
+    if (line[length - 1] == '\n') {
+      line[--length] = '\0';
+    }
+    // Each mapping starts with a line such as
+    // "7f2c000000-7f2c021000 r-xp 00000000 b3:10 1234 /usr/lib/libfoo.so",
+    // followed by lines such as "Pss: 132 kB".
+    const char* space = strchr(line, ' ');
+    if (!space || space == line) {
+      continue;
+    }
+    if (space[-1] != ':') {
+      int name_offset = 0;
+      sscanf(line, "%*s %*s %*s %*s %*s %n", &name_offset);
+      category = &GetCategory(name_offset > 0 ? line + name_offset : "",
+                              plugin_directory, usage);
+      continue;
+    }
+    long long pss;
+    if (StartsWith(line, "Pss:") && sscanf(line + 4, "%lld", &pss) == 1) {
+      *category += pss * 1024;
+      usage.total += pss * 1024;
+    }
+  }
+  free(line);
+  fclose(file);
+  return true;
+}
+
+void FlutterMemoryStats::OnMessage(FlutterDesktopMessengerRef messenger,
+                                   const FlutterDesktopMessage* message,
+                                   void* user_data) {
+  FlutterDesktopMessengerSendResponse(messenger, message->response_handle,
+                                      nullptr, 0);
+  auto* self = static_cast<FlutterMemoryStats*>(user_data);
+  FlutterStandardMessageReader reader(message->message, message->message_size);
+  FlutterStandardValue value;
+  if (!reader.Read(value) || (value.type != FlutterStandardType::kInt32 &&
+                              value.type != FlutterStandardType::kInt64)) {
+    TizenLog::Error("Invalid message on %s.", kChannel);
+    return;
+  }
+  self->image_cache_ = value.int_value;
+}
+
+Eina_Bool FlutterMemoryStats::OnRecordTimer(void* data) {
+  auto* self = static_cast<FlutterMemoryStats*>(data);
+  self->Record();
+  return ECORE_CALLBACK_RENEW;
+}
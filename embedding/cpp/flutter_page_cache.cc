@@ -0,0 +1,456 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_page_cache.h"
+
+#include <app_common.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+
+#include "include/flutter_icu_data.h"
+#include "include/flutter_trace.h"
+#include "tizen_log.h"
+
+namespace {
+
+constexpr char kProfileFileName[] = "flutter_page_cache_profile";
+constexpr char kProfileHeader[] = "# flutter page cache profile v2";
+constexpr char kAotLibraryPath[] = "../lib/libapp.so";
+constexpr char kIcuDataPath[] = "../res/icudtl.dat";
+constexpr char kAssetsPath[] = "../res/flutter_assets";
+
+// Ranges are split into tasks of at most this many pages so that a large
+// file can be read by multiple threads.
+constexpr uint32_t kMaxTaskPages = 256;
+
+int64_t NowInMilliseconds() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+size_t GetPageSize() {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+size_t GetPageCount(int64_t size) {
+  return (size + GetPageSize() - 1) / GetPageSize();
+}
+
+bool StatFile(const std::string &path, int64_t &size,
+              int64_t &modification_time) {
+  struct stat file_stat;
+  if (stat(path.c_str(), &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+    return false;
+  }
+  size = file_stat.st_size;
+  modification_time = file_stat.st_mtime;
+  return true;
+}
+
+void ListFiles(const std::string &directory, std::vector<std::string> &files) {
+  DIR *dir = opendir(directory.c_str());
+  if (!dir) {
+    return;
+  }
+  while (struct dirent *entry = readdir(dir)) {
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    std::string path = directory + "/" + entry->d_name;
+    if (entry->d_type == DT_DIR) {
+      ListFiles(path, files);
+    } else if (entry->d_type == DT_REG) {
+      files.push_back(path);
+    }
+  }
+  closedir(dir);
+}
+
+// Returns whether each page of the file opened as |fd| in the byte range
+// [|offset|, |offset| + |length|) is in the page cache.
+bool GetResidency(int fd, int64_t offset, size_t length,
+                  std::vector<unsigned char> &residency) {
+  void *address = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, offset);
+  if (address == MAP_FAILED) {
+    return false;
+  }
+  residency.resize(GetPageCount(length));
+  bool result = mincore(address, length, residency.data()) == 0;
+  munmap(address, length);
+  return result;
+}
+
+double GetRatio(size_t count, size_t total) {
+  return total > 0 ? 100.0 * count / total : 0.0;
+}
+
+}  // namespace
+
+FlutterPageCache::FlutterPageCache(const std::string &profile_path)
+    : profile_path_(profile_path) {}
+
+FlutterPageCache::~FlutterPageCache() {
+  if (recording_timer_) {
+    ecore_timer_del(recording_timer_);
+  }
+  if (recording_thread_.joinable()) {
+    recording_thread_.join();
+  }
+  WaitForWarming();
+}
+
+std::string FlutterPageCache::GetDefaultProfilePath() {
+  char *data_path = app_get_data_path();
+  if (!data_path) {
+    return "";
+  }
+  std::string path = std::string(data_path) + kProfileFileName;
+  free(data_path);
+  return path;
+}
+
+std::vector<std::string> FlutterPageCache::GetDefaultFiles() {
+  std::vector<std::string> files = {kAotLibraryPath,
+                                    FlutterIcuData::Resolve(kIcuDataPath)};
+  ListFiles(kAssetsPath, files);
+  return files;
+}
+
+double FlutterPageCache::GetCachedRatio(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return -1.0;
+  }
+  struct stat file_stat;
+  std::vector<unsigned char> residency;
+  bool result = fstat(fd, &file_stat) == 0 && file_stat.st_size > 0 &&
+                GetResidency(fd, 0, file_stat.st_size, residency);
+  close(fd);
+  if (!result) {
+    return -1.0;
+  }
+  size_t cached_pages =
+      std::count_if(residency.begin(), residency.end(),
+                    [](unsigned char page) { return (page & 1) != 0; });
+  return static_cast<double>(cached_pages) / residency.size();
+}
+
+bool FlutterPageCache::StartWarming(size_t thread_count) {
+  FLUTTER_TRACE_SCOPE("FlutterPageCache::StartWarming");
+  if (!warming_threads_.empty()) {
+    return false;
+  }
+  warming_start_time_ = NowInMilliseconds();
+  warming_profile_ = ReadProfile();
+  if (warming_profile_.warmed_launches + 1 >= kRecordingInterval) {
+    TizenLog::Info("Not warming the page cache to record this launch.");
+    return false;
+  }
+  tasks_.clear();
+  size_t profiled_pages = 0;
+  for (size_t i = 0; i < warming_profile_.files.size(); i++) {
+    for (const PageRange &range : warming_profile_.files[i].ranges) {
+      for (uint32_t start = range.start; start < range.start + range.count;
+           start += kMaxTaskPages) {
+        uint32_t count =
+            std::min(kMaxTaskPages, range.start + range.count - start);
+        tasks_.push_back({i, {start, count}});
+      }
+      profiled_pages += range.count;
+    }
+  }
+  if (tasks_.empty()) {
+    return false;
+  }
+  is_warmed_ = true;
+  warming_stats_ = {};
+  warming_stats_.profiled_pages = profiled_pages;
+  next_task_ = 0;
+  cached_pages_ = 0;
+
+  thread_count = std::max<size_t>(1, std::min(thread_count, tasks_.size()));
+  running_threads_ = thread_count;
+  for (size_t i = 0; i < thread_count; i++) {
+    warming_threads_.emplace_back(&FlutterPageCache::RunWarmingTasks, this);
+  }
+  return true;
+}
+
+FlutterPageCache::WarmingStats FlutterPageCache::WaitForWarming() {
+  for (std::thread &thread : warming_threads_) {
+    thread.join();
+  }
+  warming_threads_.clear();
+  return warming_stats_;
+}
+
+void FlutterPageCache::RunWarmingTasks() {
+  int fd = -1;
+  size_t fd_file_index = 0;
+  std::vector<unsigned char> residency;
+  while (true) {
+    size_t index = next_task_.fetch_add(1);
+    if (index >= tasks_.size()) {
+      break;
+    }
+    const WarmingTask &task = tasks_[index];
+    const FileProfile &file = warming_profile_.files[task.file_index];
+    if (fd < 0 || fd_file_index != task.file_index) {
+      if (fd >= 0) {
+        close(fd);
+      }
+      fd = open(file.path.c_str(), O_RDONLY | O_CLOEXEC);
+      fd_file_index = task.file_index;
+      if (fd < 0) {
+        continue;
+      }
+    }
+    int64_t offset = static_cast<int64_t>(task.range.start) * GetPageSize();
+    if (offset >= file.size) {
+      continue;
+    }
+    size_t length = std::min<int64_t>(
+        static_cast<int64_t>(task.range.count) * GetPageSize(),
+        file.size - offset);
+
+    if (GetResidency(fd, offset, length, residency)) {
+      cached_pages_ += std::count_if(
+          residency.begin(), residency.end(),
+          [](unsigned char page) { return (page & 1) != 0; });
+    }
+    readahead(fd, offset, length);
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+
+  if (running_threads_.fetch_sub(1) == 1) {
+    warming_stats_.cached_pages = cached_pages_;
+    warming_stats_.elapsed_milliseconds =
+        NowInMilliseconds() - warming_start_time_;
+    TizenLog::Info(
+        "Warmed %zu pages of %zu files in %lld ms (%.1f%% already cached).",
+        warming_stats_.profiled_pages, warming_profile_.files.size(),
+        static_cast<long long>(warming_stats_.elapsed_milliseconds),
+        GetRatio(warming_stats_.cached_pages, warming_stats_.profiled_pages));
+    // Count this launch so that a later one is recorded.
+    warming_profile_.warmed_launches++;
+    WriteProfile(warming_profile_);
+  }
+}
+
+bool FlutterPageCache::Record(const std::vector<std::string> &files,
+                              RecordingStats *stats) {
+  FLUTTER_TRACE_SCOPE("FlutterPageCache::Record");
+  Profile profile = ReadProfile();
+  std::map<std::string, size_t> indices;
+  for (size_t i = 0; i < profile.files.size(); i++) {
+    indices[profile.files[i].path] = i;
+  }
+
+  RecordingStats result;
+  std::vector<unsigned char> residency;
+  for (const std::string &path : files) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      continue;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0 ||
+        !GetResidency(fd, 0, file_stat.st_size, residency)) {
+      close(fd);
+      continue;
+    }
+    close(fd);
+
+    // The age of each page, or -1 if not in the profile.
+    auto iter = indices.find(path);
+    std::vector<int64_t> ages(residency.size(), -1);
+    if (iter != indices.end()) {
+      for (const PageRange &range : profile.files[iter->second].ranges) {
+        for (uint32_t i = range.start;
+             i < range.start + range.count && i < ages.size(); i++) {
+          ages[i] = range.age;
+        }
+      }
+    }
+    for (size_t i = 0; i < residency.size(); i++) {
+      if ((residency[i] & 1) != 0) {
+        result.resident_pages++;
+        if (ages[i] >= 0) {
+          result.profiled_pages++;
+        }
+        ages[i] = 0;
+      } else if (ages[i] >= 0 && ++ages[i] >= kMaxPageAge) {
+        result.removed_pages++;
+        ages[i] = -1;
+      }
+    }
+
+    FileProfile file;
+    file.path = path;
+    file.size = file_stat.st_size;
+    file.modification_time = file_stat.st_mtime;
+    for (size_t i = 0; i < ages.size(); i++) {
+      if (ages[i] < 0) {
+        continue;
+      }
+      uint32_t age = static_cast<uint32_t>(ages[i]);
+      if (!file.ranges.empty() &&
+          file.ranges.back().start + file.ranges.back().count == i &&
+          file.ranges.back().age == age) {
+        file.ranges.back().count++;
+      } else {
+        file.ranges.push_back({static_cast<uint32_t>(i), 1, age});
+      }
+    }
+    if (iter != indices.end()) {
+      profile.files[iter->second] = std::move(file);
+    } else if (!file.ranges.empty()) {
+      indices[path] = profile.files.size();
+      profile.files.push_back(std::move(file));
+    }
+  }
+  // Drop files which are no longer used, e.g. the bundled ICU data once
+  // shared ICU data has been installed, and files with no pages left.
+  profile.files.erase(
+      std::remove_if(profile.files.begin(), profile.files.end(),
+                     [&files](const FileProfile &file) {
+                       return file.ranges.empty() ||
+                              std::find(files.begin(), files.end(),
+                                        file.path) == files.end();
+                     }),
+      profile.files.end());
+  profile.warmed_launches = 0;
+
+  TizenLog::Info(
+      "%zu of %zu resident pages were in the page cache profile (%.1f%%), "
+      "%zu pages were removed.",
+      result.profiled_pages, result.resident_pages,
+      GetRatio(result.profiled_pages, result.resident_pages),
+      result.removed_pages);
+  if (stats) {
+    *stats = result;
+  }
+  return WriteProfile(profile);
+}
+
+void FlutterPageCache::ScheduleRecording(double delay_seconds) {
+  if (is_warmed_ || recording_timer_ || recording_thread_.joinable()) {
+    return;
+  }
+  recording_timer_ =
+      ecore_timer_add(delay_seconds, OnRecordingDelayEnd, this);
+}
+
+Eina_Bool FlutterPageCache::OnRecordingDelayEnd(void *data) {
+  auto *self = static_cast<FlutterPageCache *>(data);
+  self->recording_timer_ = nullptr;
+  self->recording_thread_ =
+      std::thread([self]() { self->Record(GetDefaultFiles()); });
+  return ECORE_CALLBACK_CANCEL;
+}
+
+FlutterPageCache::Profile FlutterPageCache::ReadProfile() {
+  Profile profile;
+  FILE *file = fopen(profile_path_.c_str(), "r");
+  if (!file) {
+    return profile;
+  }
+  char *line = nullptr;
+  size_t line_length = 0;
+  unsigned long warmed_launches = 0;
+  bool is_valid =
+      getline(&line, &line_length, file) > 0 &&
+      strncmp(line, kProfileHeader, strlen(kProfileHeader)) == 0 &&
+      getline(&line, &line_length, file) > 0 &&
+      sscanf(line, "launches %lu", &warmed_launches) == 1;
+  profile.warmed_launches = warmed_launches;
+  // Whether the ranges that follow belong to a file which is still valid.
+  bool is_file_valid = false;
+  ssize_t length;
+  while (is_valid && (length = getline(&line, &line_length, file)) > 0) {
+    if (line[length - 1] == '\n') {
+      line[length - 1] = '\0';
+    }
+    long long size, modification_time;
+    unsigned int start, count, age;
+    int path_offset = 0;
+    if (sscanf(line, "file %lld %lld %n", &size, &modification_time,
+               &path_offset) == 2 &&
+        path_offset > 0) {
+      FileProfile file_profile;
+      file_profile.path = line + path_offset;
+      int64_t current_size, current_modification_time;
+      is_file_valid = StatFile(file_profile.path, current_size,
+                               current_modification_time) &&
+                      current_size == size &&
+                      current_modification_time == modification_time;
+      if (is_file_valid) {
+        file_profile.size = size;
+        file_profile.modification_time = modification_time;
+        profile.files.push_back(std::move(file_profile));
+      }
+    } else if (sscanf(line, "%u %u %u", &start, &count, &age) == 3) {
+      if (is_file_valid && count > 0 &&
+          start + count <= GetPageCount(profile.files.back().size)) {
+        profile.files.back().ranges.push_back({start, count, age});
+      }
+    } else {
+      is_valid = false;
+    }
+  }
+  free(line);
+  fclose(file);
+  if (!is_valid) {
+    TizenLog::Warn("Ignoring an invalid page cache profile: %s",
+                   profile_path_.c_str());
+    profile = Profile();
+  }
+  return profile;
+}
+
+bool FlutterPageCache::WriteProfile(const Profile &profile) {
+  // Write to a temporary file first so that a partially written profile is
+  // never read.
+  std::string temp_path = profile_path_ + ".tmp";
+  FILE *file = fopen(temp_path.c_str(), "w");
+  if (!file) {
+    TizenLog::Error("Could not write the page cache profile: %s",
+                    strerror(errno));
+    return false;
+  }
+  fprintf(file, "%s\n", kProfileHeader);
+  fprintf(file, "launches %zu\n", profile.warmed_launches);
+  for (const FileProfile &file_profile : profile.files) {
+    fprintf(file, "file %lld %lld %s\n",
+            static_cast<long long>(file_profile.size),
+            static_cast<long long>(file_profile.modification_time),
+            file_profile.path.c_str());
+    for (const PageRange &range : file_profile.ranges) {
+      fprintf(file, "%u %u %u\n", range.start, range.count, range.age);
+    }
+  }
+  bool result = fclose(file) == 0;
+  if (!result || rename(temp_path.c_str(), profile_path_.c_str()) != 0) {
+    TizenLog::Error("Could not write the page cache profile: %s",
+                    strerror(errno));
+    remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
@@ -6,50 +6,133 @@
 
 #include <cassert>
 
+#include "include/flutter_memory_pressure.h"
+#include "include/flutter_memory_stats.h"
+#include "include/flutter_trace.h"
+#include "include/flutter_watchdog.h"
 #include "tizen_log.h"
 
 bool FlutterServiceApp::OnCreate() {
+  FLUTTER_TRACE_SCOPE("FlutterServiceApp::OnCreate");
+  FlutterWatchdog::ScopedActivity activity("FlutterServiceApp::OnCreate");
   TizenLog::Debug("Launching a Flutter service application...");
 
-  engine_ = FlutterEngine::Create(dart_entrypoint_, {}, ui_thread_policy_);
-  if (!engine_) {
-    TizenLog::Error("Could not create a Flutter engine.");
+  std::string error;
+  if (!thread_config_.Validate(error)) {
+    TizenLog::Error("Invalid thread configuration: %s", error.c_str());
     return false;
   }
 
-  if (!engine_->Run()) {
+  if (watchdog_threshold_ > 0.0) {
+    watchdog_ = std::make_unique<FlutterWatchdog>(
+        watchdog_threshold_, is_watchdog_stack_dump_enabled_);
+    watchdog_->Start();
+  }
+
+  if (!engine_pool_) {
+    engine_pool_ = std::make_unique<FlutterEnginePool>(
+        dart_entrypoint_, std::vector<std::string>{}, ui_thread_policy_);
+  }
+  // A service app has no view, so it can take an engine which has already
+  // been started.
+  engine_ = engine_pool_->AcquireRunning();
+  if (!engine_) {
     TizenLog::Error("Could not run a Flutter engine.");
     return false;
   }
+  if (!thread_config_.IsEmpty()) {
+    FlutterEngineThreads::Apply(thread_config_);
+  }
+  if (app_control_coalescing_window_ > 0.0) {
+    app_control_coalescer_ = std::make_unique<FlutterAppControlCoalescer>(
+        [this](app_control_h app_control) {
+          engine_->NotifyAppControl(app_control);
+        },
+        app_control_coalescing_window_, engine_->GetMessenger());
+  }
+  if (page_cache_) {
+    page_cache_->ScheduleRecording(FlutterPageCache::kRecordingDelaySeconds);
+  }
+  if (launch_timer_) {
+    launch_timer_->MarkCreated();
+    // A service app has no UI, so the launch ends here.
+    launch_timer_->Finish();
+  }
   return true;
 }
 
 void FlutterServiceApp::OnTerminate() {
+  FLUTTER_TRACE_SCOPE("FlutterServiceApp::OnTerminate");
+  FlutterWatchdog::ScopedActivity activity("FlutterServiceApp::OnTerminate");
   assert(IsRunning());
+  if (app_control_coalescer_) {
+    app_control_coalescer_->Flush();
+    app_control_coalescer_ = nullptr;
+  }
+  if (worker_pool_) {
+    worker_pool_->Shutdown();
+    worker_pool_ = nullptr;
+  }
+  engine_pool_->Clear();
   engine_ = nullptr;
+  watchdog_ = nullptr;
+  page_cache_ = nullptr;
 }
 
 void FlutterServiceApp::OnAppControlReceived(app_control_h app_control) {
+  FLUTTER_TRACE_SCOPE("FlutterServiceApp::OnAppControlReceived");
+  FlutterWatchdog::ScopedActivity activity(
+      "FlutterServiceApp::OnAppControlReceived");
   assert(IsRunning());
-  engine_->NotifyAppControl(app_control);
+  if (app_control_coalescer_) {
+    app_control_coalescer_->Add(app_control);
+  } else {
+    engine_->NotifyAppControl(app_control);
+  }
 }
 
 void FlutterServiceApp::OnLowMemory(app_event_info_h event_info) {
+  FLUTTER_TRACE_SCOPE("FlutterServiceApp::OnLowMemory");
+  FlutterWatchdog::ScopedActivity activity("FlutterServiceApp::OnLowMemory");
   assert(IsRunning());
-  engine_->NotifyLowMemoryWarning();
+  FlutterMemoryPressure::Reclaim(FlutterMemoryPressure::GetLevel(event_info),
+                                 GetEngines(), engine_pool_.get());
+  // Sampling takes a few milliseconds, so it is done after reclaiming and
+  // only if the result can be logged.
+  if constexpr (TIZEN_LOG_MIN_PRIORITY <= DLOG_INFO) {
+    if (FlutterMemoryStats *stats = engine_->GetMemoryStats()) {
+      FlutterMemoryStats::Log(stats->Record());
+    }
+  }
 }
 
 void FlutterServiceApp::OnLanguageChanged(app_event_info_h event_info) {
+  FLUTTER_TRACE_SCOPE("FlutterServiceApp::OnLanguageChanged");
+  FlutterWatchdog::ScopedActivity activity(
+      "FlutterServiceApp::OnLanguageChanged");
   assert(IsRunning());
-  engine_->NotifyLocaleChange();
+  for (FlutterEngine *engine : GetEngines()) {
+    engine->NotifyLocaleChange();
+  }
 }
 
 void FlutterServiceApp::OnRegionFormatChanged(app_event_info_h event_info) {
+  FLUTTER_TRACE_SCOPE("FlutterServiceApp::OnRegionFormatChanged");
+  FlutterWatchdog::ScopedActivity activity(
+      "FlutterServiceApp::OnRegionFormatChanged");
   assert(IsRunning());
-  engine_->NotifyLocaleChange();
+  for (FlutterEngine *engine : GetEngines()) {
+    engine->NotifyLocaleChange();
+  }
 }
 
 int FlutterServiceApp::Run(int argc, char **argv) {
+  FLUTTER_TRACE_INSTANT("FlutterServiceApp::Run");
+  if (is_launch_timer_enabled_) {
+    launch_timer_ = std::make_unique<FlutterLaunchTimer>();
+    launch_timer_->Start(argc, argv);
+  }
+
   service_app_lifecycle_callback_s lifecycle_cb = {};
   lifecycle_cb.create = [](void *data) -> bool {
     auto *app = reinterpret_cast<FlutterServiceApp *>(data);
@@ -75,6 +158,10 @@ int FlutterServiceApp::Run(int argc, char **argv) {
   service_app_add_event_handler(
       &handler, APP_EVENT_LOW_BATTERY,
       [](app_event_info_h e, void *data) {
+        // Marked here since subclasses override the handler.
+        FLUTTER_TRACE_SCOPE("FlutterServiceApp::OnLowBattery");
+        FlutterWatchdog::ScopedActivity activity(
+            "FlutterServiceApp::OnLowBattery");
         auto *app = reinterpret_cast<FlutterServiceApp *>(data);
         app->OnLowBattery(e);
       },
@@ -94,6 +181,18 @@ int FlutterServiceApp::Run(int argc, char **argv) {
       },
       this);
 
+  if (is_page_cache_warming_enabled_) {
+    page_cache_ = std::make_unique<FlutterPageCache>(
+        FlutterPageCache::GetDefaultProfilePath());
+    page_cache_->StartWarming();
+  }
+
+  if (is_engine_preload_enabled_) {
+    engine_pool_ = std::make_unique<FlutterEnginePool>(
+        dart_entrypoint_, std::vector<std::string>{}, ui_thread_policy_);
+    engine_pool_->PreloadArguments();
+  }
+
   int ret = service_app_main(argc, argv, &lifecycle_cb, this);
   if (ret != APP_ERROR_NONE) {
     TizenLog::Error("Could not launch a service application. (%d)", ret);
@@ -108,3 +207,30 @@ FlutterDesktopPluginRegistrarRef FlutterServiceApp::GetRegistrarForPlugin(
   }
   return nullptr;
 }
+
+size_t FlutterServiceApp::SpawnWorkers(
+    size_t count, const std::string &dart_entrypoint,
+    const std::vector<std::string> &dart_entrypoint_args) {
+  assert(IsRunning());
+  if (!worker_pool_) {
+    worker_pool_ = std::make_unique<FlutterWorkerPool>();
+  }
+  size_t spawned =
+      worker_pool_->Spawn(engine_pool_->GetArguments(), count, dart_entrypoint,
+                          dart_entrypoint_args);
+  if (spawned > 0 && !thread_config_.IsEmpty()) {
+    // Apply the settings to the threads of the new engines.
+    FlutterEngineThreads::Apply(thread_config_);
+  }
+  return spawned;
+}
+
+std::vector<FlutterEngine *> FlutterServiceApp::GetEngines() {
+  std::vector<FlutterEngine *> engines = {engine_.get()};
+  if (worker_pool_) {
+    for (FlutterEngine *engine : worker_pool_->GetEngines()) {
+      engines.push_back(engine);
+    }
+  }
+  return engines;
+}
@@ -0,0 +1,300 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_standard_message.h"
+
+#include <cstring>
+#include <limits>
+
+namespace {
+
+// Sizes below this value are encoded in a single byte.
+constexpr uint8_t kSizeUint16 = 254;
+constexpr uint8_t kSizeUint32 = 255;
+
+// The number of values which follow |value| as its elements.
+size_t GetElementCount(const FlutterStandardValue& value) {
+  if (value.type == FlutterStandardType::kList) {
+    return value.length;
+  }
+  if (value.type == FlutterStandardType::kMap) {
+    return value.length * 2;
+  }
+  return 0;
+}
+
+}  // namespace
+
+bool FlutterStandardMessageReader::Read(FlutterStandardValue& value) {
+  if (IsAtEnd()) {
+    return false;
+  }
+  const uint8_t* type = ReadBytes(1);
+  if (!type) {
+    return false;
+  }
+  value = FlutterStandardValue();
+  value.type = static_cast<FlutterStandardType>(*type);
+  switch (value.type) {
+    case FlutterStandardType::kNull:
+      return true;
+    case FlutterStandardType::kTrue:
+      value.int_value = 1;
+      return true;
+    case FlutterStandardType::kFalse:
+      return true;
+    case FlutterStandardType::kInt32: {
+      const uint8_t* bytes = ReadBytes(sizeof(int32_t));
+      if (!bytes) {
+        return false;
+      }
+      int32_t int_value;
+      memcpy(&int_value, bytes, sizeof(int_value));
+      value.int_value = int_value;
+      return true;
+    }
+    case FlutterStandardType::kInt64: {
+      const uint8_t* bytes = ReadBytes(sizeof(int64_t));
+      if (!bytes) {
+        return false;
+      }
+      memcpy(&value.int_value, bytes, sizeof(value.int_value));
+      return true;
+    }
+    case FlutterStandardType::kFloat64: {
+      if (!ReadAlignment(sizeof(double))) {
+        return false;
+      }
+      const uint8_t* bytes = ReadBytes(sizeof(double));
+      if (!bytes) {
+        return false;
+      }
+      memcpy(&value.double_value, bytes, sizeof(value.double_value));
+      return true;
+    }
+    case FlutterStandardType::kLargeInt:
+    case FlutterStandardType::kString:
+    case FlutterStandardType::kUint8List:
+      return ReadTypedList(1, value);
+    case FlutterStandardType::kInt32List:
+      return ReadTypedList(sizeof(int32_t), value);
+    case FlutterStandardType::kInt64List:
+      return ReadTypedList(sizeof(int64_t), value);
+    case FlutterStandardType::kFloat32List:
+      return ReadTypedList(sizeof(float), value);
+    case FlutterStandardType::kFloat64List:
+      return ReadTypedList(sizeof(double), value);
+    case FlutterStandardType::kList:
+    case FlutterStandardType::kMap: {
+      if (!ReadSize(value.length)) {
+        return false;
+      }
+      // Every element takes at least one byte, which bounds the length of a
+      // well-formed message.
+      size_t max_length = size_ - offset_;
+      if (value.type == FlutterStandardType::kMap) {
+        max_length /= 2;
+      }
+      if (value.length > max_length) {
+        return Fail();
+      }
+      return true;
+    }
+  }
+  return Fail();
+}
+
+bool FlutterStandardMessageReader::Skip() {
+  FlutterStandardValue value;
+  if (!Read(value)) {
+    return false;
+  }
+  // Count the values left to skip instead of recursing, so that deeply
+  // nested messages cannot overflow the stack.
+  size_t remaining = GetElementCount(value);
+  while (remaining > 0) {
+    if (!Read(value)) {
+      // The message ends inside a list or a map.
+      return Fail();
+    }
+    remaining = remaining - 1 + GetElementCount(value);
+  }
+  return true;
+}
+
+bool FlutterStandardMessageReader::ReadSize(size_t& size) {
+  const uint8_t* bytes = ReadBytes(1);
+  if (!bytes) {
+    return false;
+  }
+  if (*bytes < kSizeUint16) {
+    size = *bytes;
+  } else if (*bytes == kSizeUint16) {
+    uint16_t value;
+    if (!(bytes = ReadBytes(sizeof(value)))) {
+      return false;
+    }
+    memcpy(&value, bytes, sizeof(value));
+    size = value;
+  } else {
+    uint32_t value;
+    if (!(bytes = ReadBytes(sizeof(value)))) {
+      return false;
+    }
+    memcpy(&value, bytes, sizeof(value));
+    size = value;
+  }
+  return true;
+}
+
+bool FlutterStandardMessageReader::ReadAlignment(size_t alignment) {
+  size_t padding = (alignment - offset_ % alignment) % alignment;
+  return padding == 0 || ReadBytes(padding) != nullptr;
+}
+
+const uint8_t* FlutterStandardMessageReader::ReadBytes(size_t length) {
+  if (has_error_ || length > size_ - offset_) {
+    Fail();
+    return nullptr;
+  }
+  const uint8_t* bytes = data_ + offset_;
+  offset_ += length;
+  return bytes;
+}
+
+bool FlutterStandardMessageReader::ReadTypedList(size_t element_size,
+                                                 FlutterStandardValue& value) {
+  if (!ReadSize(value.length) || !ReadAlignment(element_size)) {
+    return false;
+  }
+  if (value.length > (size_ - offset_) / element_size) {
+    return Fail();
+  }
+  value.data = ReadBytes(value.length * element_size);
+  return value.data != nullptr;
+}
+
+bool FlutterStandardMessageReader::Fail() {
+  has_error_ = true;
+  return false;
+}
+
+void FlutterStandardMessageWriter::WriteNull() {
+  WriteType(FlutterStandardType::kNull);
+}
+
+void FlutterStandardMessageWriter::WriteBool(bool value) {
+  WriteType(value ? FlutterStandardType::kTrue : FlutterStandardType::kFalse);
+}
+
+void FlutterStandardMessageWriter::WriteInt(int64_t value) {
+  if (value >= std::numeric_limits<int32_t>::min() &&
+      value <= std::numeric_limits<int32_t>::max()) {
+    int32_t int32_value = static_cast<int32_t>(value);
+    WriteType(FlutterStandardType::kInt32);
+    WriteBytes(&int32_value, sizeof(int32_value));
+  } else {
+    WriteType(FlutterStandardType::kInt64);
+    WriteBytes(&value, sizeof(value));
+  }
+}
+
+void FlutterStandardMessageWriter::WriteDouble(double value) {
+  WriteType(FlutterStandardType::kFloat64);
+  WriteAlignment(sizeof(double));
+  WriteBytes(&value, sizeof(value));
+}
+
+void FlutterStandardMessageWriter::WriteString(std::string_view value) {
+  WriteTypedList(FlutterStandardType::kString, value.data(), value.size(), 1);
+}
+
+void FlutterStandardMessageWriter::WriteUint8List(const uint8_t* data,
+                                                  size_t length) {
+  WriteTypedList(FlutterStandardType::kUint8List, data, length, 1);
+}
+
+void FlutterStandardMessageWriter::WriteInt32List(const int32_t* data,
+                                                  size_t length) {
+  WriteTypedList(FlutterStandardType::kInt32List, data, length,
+                 sizeof(int32_t));
+}
+
+void FlutterStandardMessageWriter::WriteInt64List(const int64_t* data,
+                                                  size_t length) {
+  WriteTypedList(FlutterStandardType::kInt64List, data, length,
+                 sizeof(int64_t));
+}
+
+void FlutterStandardMessageWriter::WriteFloat32List(const float* data,
+                                                    size_t length) {
+  WriteTypedList(FlutterStandardType::kFloat32List, data, length,
+                 sizeof(float));
+}
+
+void FlutterStandardMessageWriter::WriteFloat64List(const double* data,
+                                                    size_t length) {
+  WriteTypedList(FlutterStandardType::kFloat64List, data, length,
+                 sizeof(double));
+}
+
+void FlutterStandardMessageWriter::BeginList(size_t length) {
+  WriteType(FlutterStandardType::kList);
+  WriteSize(length);
+}
+
+void FlutterStandardMessageWriter::BeginMap(size_t length) {
+  WriteType(FlutterStandardType::kMap);
+  WriteSize(length);
+}
+
+std::vector<uint8_t> FlutterStandardMessageWriter::TakeBuffer() {
+  std::vector<uint8_t> buffer;
+  buffer.swap(buffer_);
+  return buffer;
+}
+
+void FlutterStandardMessageWriter::WriteType(FlutterStandardType type) {
+  buffer_.push_back(static_cast<uint8_t>(type));
+}
+
+void FlutterStandardMessageWriter::WriteSize(size_t size) {
+  if (size < kSizeUint16) {
+    buffer_.push_back(static_cast<uint8_t>(size));
+  } else if (size <= std::numeric_limits<uint16_t>::max()) {
+    uint16_t value = static_cast<uint16_t>(size);
+    buffer_.push_back(kSizeUint16);
+    WriteBytes(&value, sizeof(value));
+  } else {
+    uint32_t value = static_cast<uint32_t>(size);
+    buffer_.push_back(kSizeUint32);
+    WriteBytes(&value, sizeof(value));
+  }
+}
+
+void FlutterStandardMessageWriter::WriteAlignment(size_t alignment) {
+  size_t padding = (alignment - buffer_.size() % alignment) % alignment;
+  buffer_.insert(buffer_.end(), padding, 0);
+}
+
+void FlutterStandardMessageWriter::WriteBytes(const void* data,
+                                              size_t length) {
+  if (length == 0) {
+    return;
+  }
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  buffer_.insert(buffer_.end(), bytes, bytes + length);
+}
+
+void FlutterStandardMessageWriter::WriteTypedList(FlutterStandardType type,
+                                                  const void* data,
+                                                  size_t length,
+                                                  size_t element_size) {
+  WriteType(type);
+  WriteSize(length);
+  WriteAlignment(element_size);
+  // Reserve once so that large lists are copied in a single pass.
+  buffer_.reserve(buffer_.size() + length * element_size);
+  WriteBytes(data, length * element_size);
+}
@@ -0,0 +1,160 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_task_queue.h"
+
+#include <Ecore.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include "tizen_log.h"
+
+namespace {
+
+// Sends the reply to a message once, on the platform thread.
+//
+// If the handler drops the reply without calling it, an empty reply is sent
+// so that the Dart side is not left waiting.
+class PendingReply {
+ public:
+  PendingReply(FlutterDesktopMessengerRef messenger,
+               const FlutterDesktopMessageResponseHandle* response_handle)
+      : messenger_(messenger), response_handle_(response_handle) {
+    FlutterDesktopMessengerAddRef(messenger_);
+  }
+
+  ~PendingReply() {
+    if (!is_sent_) {
+      Send(nullptr, 0);
+    }
+    FlutterDesktopMessengerRelease(messenger_);
+  }
+
+  void Send(const uint8_t* reply, size_t reply_size) {
+    if (is_sent_.exchange(true)) {
+      TizenLog::Error("A reply has already been sent.");
+      return;
+    }
+    FlutterDesktopMessengerRef messenger = messenger_;
+    const FlutterDesktopMessageResponseHandle* response_handle =
+        response_handle_;
+    FlutterDesktopMessengerAddRef(messenger);
+    std::vector<uint8_t> data(reply, reply + reply_size);
+    FlutterTaskQueue::PostToPlatformThread(
+        [messenger, response_handle, data = std::move(data)]() {
+          // The engine may have been shut down in the meantime.
+          FlutterDesktopMessengerLock(messenger);
+          if (FlutterDesktopMessengerIsAvailable(messenger)) {
+            FlutterDesktopMessengerSendResponse(messenger, response_handle,
+                                                data.data(), data.size());
+          }
+          FlutterDesktopMessengerUnlock(messenger);
+          FlutterDesktopMessengerRelease(messenger);
+        });
+  }
+
+ private:
+  FlutterDesktopMessengerRef messenger_;
+  const FlutterDesktopMessageResponseHandle* response_handle_;
+  std::atomic<bool> is_sent_{false};
+};
+
+}  // namespace
+
+FlutterTaskQueue::FlutterTaskQueue(Type type, size_t thread_count) {
+  if (type == Type::kSerial) {
+    thread_count = 1;
+  } else if (thread_count == 0) {
+    thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  for (size_t i = 0; i < thread_count; i++) {
+    threads_.emplace_back(&FlutterTaskQueue::RunTasks, this);
+  }
+}
+
+FlutterTaskQueue::~FlutterTaskQueue() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_shutting_down_ = true;
+    tasks_.clear();
+  }
+  condition_.notify_all();
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void FlutterTaskQueue::Post(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+void FlutterTaskQueue::PostToPlatformThread(std::function<void()> task) {
+  auto* data = new std::function<void()>(std::move(task));
+  ecore_main_loop_thread_safe_call_async(
+      [](void* data) {
+        auto* task = static_cast<std::function<void()>*>(data);
+        (*task)();
+        delete task;
+      },
+      data);
+}
+
+void FlutterTaskQueue::RunTasks() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() {
+        return is_shutting_down_ || !tasks_.empty();
+      });
+      if (is_shutting_down_) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+FlutterBackgroundChannel::FlutterBackgroundChannel(
+    FlutterDesktopMessengerRef messenger, const std::string& channel,
+    std::shared_ptr<FlutterTaskQueue> task_queue, Handler handler)
+    : messenger_(messenger),
+      channel_(channel),
+      task_queue_(std::move(task_queue)),
+      handler_(std::make_shared<Handler>(std::move(handler))) {
+  FlutterDesktopMessengerSetCallback(messenger_, channel_.c_str(), OnMessage,
+                                     this);
+}
+
+FlutterBackgroundChannel::~FlutterBackgroundChannel() {
+  FlutterDesktopMessengerSetCallback(messenger_, channel_.c_str(), nullptr,
+                                     nullptr);
+}
+
+void FlutterBackgroundChannel::OnMessage(FlutterDesktopMessengerRef messenger,
+                                         const FlutterDesktopMessage* message,
+                                         void* user_data) {
+  auto* self = static_cast<FlutterBackgroundChannel*>(user_data);
+  // The message is only valid during this call.
+  std::vector<uint8_t> data(message->message,
+                            message->message + message->message_size);
+  auto reply =
+      std::make_shared<PendingReply>(messenger, message->response_handle);
+  std::shared_ptr<Handler> handler = self->handler_;
+  self->task_queue_->Post(
+      [handler, reply, data = std::move(data)]() {
+        (*handler)(data.data(), data.size(),
+                   [reply](const uint8_t* result, size_t result_size) {
+                     reply->Send(result, result_size);
+                   });
+      });
+}
@@ -0,0 +1,152 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_trace.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+constexpr uint32_t kBinaryFormatVersion = 1;
+
+// A ring buffer slot guarded by a sequence number, so that readers can detect
+// and skip slots which are being written concurrently.
+struct TraceEvent {
+  // Odd while the slot is being written, even otherwise.
+  std::atomic<uint64_t> sequence{0};
+  std::atomic<const char *> name{nullptr};
+  std::atomic<uint64_t> timestamp{0};
+  std::atomic<uint32_t> thread_id{0};
+  std::atomic<char> phase{0};
+};
+
+struct TraceEventSnapshot {
+  const char *name;
+  uint64_t timestamp;
+  uint32_t thread_id;
+  char phase;
+};
+
+TraceEvent g_events[FlutterTrace::kCapacity];
+std::atomic<uint64_t> g_next_index{0};
+
+uint32_t GetThreadId() {
+  static thread_local uint32_t thread_id =
+      static_cast<uint32_t>(syscall(SYS_gettid));
+  return thread_id;
+}
+
+uint64_t GetTimestamp() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+std::vector<TraceEventSnapshot> Snapshot() {
+  std::vector<TraceEventSnapshot> snapshot;
+  uint64_t end = g_next_index.load(std::memory_order_acquire);
+  uint64_t begin =
+      end > FlutterTrace::kCapacity ? end - FlutterTrace::kCapacity : 0;
+  snapshot.reserve(end - begin);
+  for (uint64_t index = begin; index < end; index++) {
+    TraceEvent &event = g_events[index % FlutterTrace::kCapacity];
+    uint64_t sequence = event.sequence.load(std::memory_order_acquire);
+    if (sequence != index * 2 + 2) {
+      // Being written or already overwritten by a newer event.
+      continue;
+    }
+    TraceEventSnapshot copy = {
+        event.name.load(std::memory_order_relaxed),
+        event.timestamp.load(std::memory_order_relaxed),
+        event.thread_id.load(std::memory_order_relaxed),
+        event.phase.load(std::memory_order_relaxed),
+    };
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (event.sequence.load(std::memory_order_relaxed) == sequence &&
+        copy.name) {
+      snapshot.push_back(copy);
+    }
+  }
+  return snapshot;
+}
+
+void AppendUint(std::vector<uint8_t> &buffer, uint64_t value, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    buffer.push_back(static_cast<uint8_t>(value >> (i * 8)));
+  }
+}
+
+}  // namespace
+
+void FlutterTrace::Record(const char *name, Phase phase) {
+  uint64_t index = g_next_index.fetch_add(1, std::memory_order_relaxed);
+  TraceEvent &event = g_events[index % kCapacity];
+  event.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  event.name.store(name, std::memory_order_relaxed);
+  event.timestamp.store(GetTimestamp(), std::memory_order_relaxed);
+  event.thread_id.store(GetThreadId(), std::memory_order_relaxed);
+  event.phase.store(static_cast<char>(phase), std::memory_order_relaxed);
+  event.sequence.store(index * 2 + 2, std::memory_order_release);
+}
+
+std::string FlutterTrace::ExportChromeTraceJson() {
+  std::string json = "{\"traceEvents\":[";
+  int pid = getpid();
+  bool first = true;
+  for (const TraceEventSnapshot &event : Snapshot()) {
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer),
+             "%s{\"name\":\"%s\",\"cat\":\"embedding\",\"ph\":\"%c\","
+             "\"ts\":%" PRIu64 ".%03" PRIu64 ",\"pid\":%d,\"tid\":%" PRIu32
+             "%s}",
+             first ? "" : ",", event.name, event.phase,
+             event.timestamp / 1000, event.timestamp % 1000, pid,
+             event.thread_id, event.phase == 'i' ? ",\"s\":\"t\"" : "");
+    json += buffer;
+    first = false;
+  }
+  json += "],\"displayTimeUnit\":\"ms\"}";
+  return json;
+}
+
+std::vector<uint8_t> FlutterTrace::ExportBinary() {
+  std::vector<TraceEventSnapshot> events = Snapshot();
+  std::vector<uint8_t> buffer = {'F', 'T', 'R', 'C'};
+  AppendUint(buffer, kBinaryFormatVersion, sizeof(uint32_t));
+  AppendUint(buffer, events.size(), sizeof(uint32_t));
+  for (const TraceEventSnapshot &event : events) {
+    size_t name_length = std::min<size_t>(strlen(event.name), UINT8_MAX);
+    AppendUint(buffer, event.timestamp, sizeof(uint64_t));
+    AppendUint(buffer, event.thread_id, sizeof(uint32_t));
+    buffer.push_back(static_cast<uint8_t>(event.phase));
+    buffer.push_back(static_cast<uint8_t>(name_length));
+    buffer.insert(buffer.end(), event.name, event.name + name_length);
+  }
+  return buffer;
+}
+
+bool FlutterTrace::WriteToFile(const std::string &path, bool binary) {
+  FILE *file = fopen(path.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+  bool result;
+  if (binary) {
+    std::vector<uint8_t> data = ExportBinary();
+    result = fwrite(data.data(), 1, data.size(), file) == data.size();
+  } else {
+    std::string data = ExportChromeTraceJson();
+    result = fwrite(data.data(), 1, data.size(), file) == data.size();
+  }
+  return fclose(file) == 0 && result;
+}
@@ -0,0 +1,283 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_watchdog.h"
+
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+#include "tizen_log.h"
+
+namespace {
+
+constexpr std::chrono::milliseconds kMinInterval(50);
+constexpr std::chrono::milliseconds kStackCaptureTimeout(100);
+constexpr int kMaxStackDepth = 64;
+
+// The time of the last heartbeat, in nanoseconds of the steady clock.
+std::atomic<int64_t> g_last_heartbeat{0};
+
+// The activity running on the platform thread and its start time.
+std::atomic<const char *> g_activity_name{nullptr};
+std::atomic<int64_t> g_activity_start_time{0};
+
+// The sequence number of the last stack capture request.
+std::atomic<int> g_last_stack_request{0};
+
+// The sequence number of the request waiting for |OnStackSignal|, or 0 if
+// none. Whoever resets it first, the handler or the timed out requester,
+// owns the request, so a late signal never writes to |g_stack|.
+std::atomic<int> g_pending_stack_request{0};
+
+// The native stack captured by |OnStackSignal|, and its depth or -1 if not
+// captured yet.
+void *g_stack[kMaxStackDepth];
+std::atomic<int> g_stack_depth{-1};
+
+// Installs |OnStackSignal| only once, since a signal may still be pending
+// after a request times out.
+std::once_flag g_install_flag;
+
+// The SIGUSR2 action replaced by |OnStackSignal|, which gets the signals not
+// sent by the watchdog.
+struct sigaction g_previous_action;
+
+int64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+std::chrono::milliseconds ToMilliseconds(int64_t nanoseconds) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::nanoseconds(nanoseconds));
+}
+
+// Whether |info| is of a signal sent by |CaptureNativeStack|.
+bool IsStackSignal(const siginfo_t *info) {
+  int request = info->si_value.sival_int;
+  return info->si_code == SI_QUEUE && info->si_pid == getpid() &&
+         request > 0 && request <= g_last_stack_request.load();
+}
+
+void OnStackSignal(int signal, siginfo_t *info, void *context) {
+  if (!IsStackSignal(info)) {
+    if (g_previous_action.sa_flags & SA_SIGINFO) {
+      g_previous_action.sa_sigaction(signal, info, context);
+    } else if (g_previous_action.sa_handler != SIG_DFL &&
+               g_previous_action.sa_handler != SIG_IGN) {
+      g_previous_action.sa_handler(signal);
+    }
+    return;
+  }
+  // Ignore signals of requests which have already timed out.
+  int request = info->si_value.sival_int;
+  if (!g_pending_stack_request.compare_exchange_strong(request, 0)) {
+    return;
+  }
+  g_stack_depth.store(backtrace(g_stack, kMaxStackDepth));
+}
+
+void InstallStackSignalHandler() {
+  // Load the unwinder now, since it cannot be loaded safely from a signal
+  // handler.
+  void *frame;
+  backtrace(&frame, 1);
+
+  struct sigaction action = {};
+  action.sa_sigaction = OnStackSignal;
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGUSR2, &action, &g_previous_action);
+}
+
+}  // namespace
+
+FlutterWatchdog::ScopedActivity::ScopedActivity(const char *name)
+    : previous_name_(g_activity_name.load(std::memory_order_relaxed)),
+      previous_start_time_(
+          g_activity_start_time.load(std::memory_order_relaxed)) {
+  g_activity_start_time.store(Now(), std::memory_order_relaxed);
+  g_activity_name.store(name, std::memory_order_release);
+}
+
+FlutterWatchdog::ScopedActivity::~ScopedActivity() {
+  g_activity_start_time.store(previous_start_time_, std::memory_order_relaxed);
+  g_activity_name.store(previous_name_, std::memory_order_release);
+}
+
+FlutterWatchdog::FlutterWatchdog(double threshold_seconds,
+                                 bool dump_native_stack,
+                                 StallCallback callback)
+    : threshold_(static_cast<int64_t>(threshold_seconds * 1000)),
+      interval_(std::max(threshold_ / 4, kMinInterval)),
+      dump_native_stack_(dump_native_stack),
+      callback_(std::move(callback)) {}
+
+FlutterWatchdog::~FlutterWatchdog() {
+  Stop();
+}
+
+bool FlutterWatchdog::Start() {
+  if (heartbeat_timer_) {
+    return false;
+  }
+  g_last_heartbeat.store(Now());
+  heartbeat_timer_ = ecore_timer_add(
+      std::chrono::duration<double>(interval_).count(), OnHeartbeat, this);
+  if (!heartbeat_timer_) {
+    TizenLog::Error("Could not start the watchdog heartbeat.");
+    return false;
+  }
+  if (dump_native_stack_) {
+    std::call_once(g_install_flag, InstallStackSignalHandler);
+  }
+  is_stopping_ = false;
+  monitor_thread_ = std::thread(&FlutterWatchdog::Monitor, this);
+  return true;
+}
+
+void FlutterWatchdog::Stop() {
+  if (!heartbeat_timer_) {
+    return;
+  }
+  ecore_timer_del(heartbeat_timer_);
+  heartbeat_timer_ = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopping_ = true;
+  }
+  condition_.notify_all();
+  monitor_thread_.join();
+}
+
+Eina_Bool FlutterWatchdog::OnHeartbeat(void *data) {
+  g_last_heartbeat.store(Now(), std::memory_order_relaxed);
+  return ECORE_CALLBACK_RENEW;
+}
+
+void FlutterWatchdog::Monitor() {
+  int64_t threshold = std::chrono::nanoseconds(threshold_).count();
+  int64_t interval = std::chrono::nanoseconds(interval_).count();
+  int64_t last_check = Now();
+  // The last heartbeat before the current stall, or 0 if not stalled.
+  int64_t stalled_heartbeat = 0;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!condition_.wait_for(lock, interval_,
+                              [this]() { return is_stopping_; })) {
+    int64_t now = Now();
+    if (now - last_check > interval + threshold) {
+      // This thread woke up late too, so the whole process was most likely
+      // frozen by the platform (e.g. while in the background). This is not
+      // a stall of the platform thread.
+      g_last_heartbeat.store(now, std::memory_order_relaxed);
+      stalled_heartbeat = 0;
+      last_check = now;
+      continue;
+    }
+    last_check = now;
+
+    int64_t heartbeat = g_last_heartbeat.load(std::memory_order_relaxed);
+    if (now - heartbeat > threshold) {
+      if (stalled_heartbeat != heartbeat) {
+        stalled_heartbeat = heartbeat;
+        lock.unlock();
+        ReportStall(ToMilliseconds(now - heartbeat));
+        lock.lock();
+      }
+    } else if (stalled_heartbeat != 0) {
+      TizenLog::Warn("The platform thread recovered after %lld ms.",
+                     static_cast<long long>(
+                         ToMilliseconds(heartbeat - stalled_heartbeat)
+                             .count()));
+      stalled_heartbeat = 0;
+    }
+  }
+}
+
+void FlutterWatchdog::ReportStall(std::chrono::milliseconds duration) {
+  StallReport report;
+  report.duration = duration;
+  const char *activity = g_activity_name.load(std::memory_order_acquire);
+  if (activity) {
+    report.activity = activity;
+    report.activity_duration = ToMilliseconds(
+        Now() - g_activity_start_time.load(std::memory_order_relaxed));
+  }
+  if (dump_native_stack_) {
+    report.native_stack = CaptureNativeStack();
+  }
+
+  if (activity) {
+    TizenLog::Error(
+        "The platform thread has stalled for %lld ms in %s (running for %lld "
+        "ms).",
+        static_cast<long long>(report.duration.count()), activity,
+        static_cast<long long>(report.activity_duration.count()));
+  } else {
+    TizenLog::Error(
+        "The platform thread has stalled for %lld ms outside any marked "
+        "activity (most likely in Dart code).",
+        static_cast<long long>(report.duration.count()));
+  }
+  for (size_t i = 0; i < report.native_stack.size(); i++) {
+    TizenLog::Error("  #%zu %s", i, report.native_stack[i].c_str());
+  }
+
+  if (callback_) {
+    callback_(report);
+  }
+}
+
+std::vector<std::string> FlutterWatchdog::CaptureNativeStack() {
+  std::vector<std::string> stack;
+  int request = g_last_stack_request.fetch_add(1) + 1;
+  g_stack_depth.store(-1);
+  g_pending_stack_request.store(request);
+
+  // The platform thread is the main thread, whose thread ID is the process
+  // ID. The request is sent as the value of the signal, so that a signal
+  // delivered after the timeout is not mistaken for a later request.
+  pid_t pid = getpid();
+  siginfo_t info = {};
+  info.si_signo = SIGUSR2;
+  info.si_code = SI_QUEUE;
+  info.si_pid = pid;
+  info.si_uid = getuid();
+  info.si_value.sival_int = request;
+  if (syscall(SYS_rt_tgsigqueueinfo, pid, pid, SIGUSR2, &info) != 0) {
+    g_pending_stack_request.store(0);
+    return stack;
+  }
+  auto deadline = std::chrono::steady_clock::now() + kStackCaptureTimeout;
+  int depth;
+  while ((depth = g_stack_depth.load()) < 0) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      int expected = request;
+      if (g_pending_stack_request.compare_exchange_strong(expected, 0)) {
+        TizenLog::Warn("Could not capture the stack of the platform thread.");
+        return stack;
+      }
+      // The handler has just started capturing, which does not block.
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  char **symbols = backtrace_symbols(g_stack, depth);
+  if (symbols) {
+    // Skip the frames of the signal handler itself.
+    for (int i = 2; i < depth; i++) {
+      stack.push_back(symbols[i]);
+    }
+    free(symbols);
+  }
+  return stack;
+}
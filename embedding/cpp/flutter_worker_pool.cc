@@ -0,0 +1,183 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/flutter_worker_pool.h"
+
+#include "include/flutter_trace.h"
+#include "tizen_log.h"
+
+namespace {
+
+// The pools which jobs in flight belong to, keyed by job ID. Only accessed
+// on the platform thread.
+std::map<uintptr_t, FlutterWorkerPool*> g_job_pools;
+
+// The ID of the next job sent to a worker.
+uintptr_t g_next_job_id = 1;
+
+}  // namespace
+
+FlutterWorkerPool::FlutterWorkerPool(const std::string& channel,
+                                     size_t max_jobs_per_worker)
+    : channel_(channel),
+      max_jobs_per_worker_(max_jobs_per_worker > 0 ? max_jobs_per_worker
+                                                   : 1) {}
+
+FlutterWorkerPool::~FlutterWorkerPool() {
+  Shutdown();
+}
+
+size_t FlutterWorkerPool::Spawn(
+    std::shared_ptr<const FlutterEngineArguments> arguments, size_t count,
+    const std::string& dart_entrypoint,
+    const std::vector<std::string>& dart_entrypoint_args) {
+  FLUTTER_TRACE_SCOPE("FlutterWorkerPool::Spawn");
+  size_t spawned = 0;
+  for (size_t i = 0; i < count; i++) {
+    // Run the UI isolate of each worker on its own thread. Otherwise all
+    // workers would share the platform thread and run one job at a time.
+    std::unique_ptr<FlutterEngine> engine = FlutterEngine::Create(
+        arguments, dart_entrypoint, dart_entrypoint_args,
+        FlutterDesktopUIThreadPolicy::kRunOnSeparateThread);
+    if (!engine) {
+      TizenLog::Error("Could not create a worker engine.");
+      break;
+    }
+    auto worker = std::make_shared<Worker>();
+    worker->pool = this;
+    worker->engine = std::move(engine);
+    // The handler must be set before the engine runs so that the ready
+    // message of the worker is not missed.
+    FlutterDesktopMessengerSetCallback(worker->engine->GetMessenger(),
+                                       channel_.c_str(), OnWorkerMessage,
+                                       worker.get());
+    if (!worker->engine->Run()) {
+      TizenLog::Error("Could not run a worker engine.");
+      FlutterDesktopMessengerSetCallback(worker->engine->GetMessenger(),
+                                         channel_.c_str(), nullptr, nullptr);
+      break;
+    }
+    workers_.push_back(std::move(worker));
+    spawned++;
+  }
+  TizenLog::Debug("Spawned %zu worker(s) running %s.", spawned,
+                  dart_entrypoint.empty() ? "main" : dart_entrypoint.c_str());
+  return spawned;
+}
+
+void FlutterWorkerPool::Submit(std::vector<uint8_t> message,
+                               ResultCallback callback) {
+  stats_.submitted++;
+  queue_.push_back({std::move(message), std::move(callback)});
+  Dispatch();
+}
+
+void FlutterWorkerPool::Shutdown() {
+  for (std::shared_ptr<Worker>& worker : workers_) {
+    FlutterDesktopMessengerSetCallback(worker->engine->GetMessenger(),
+                                       channel_.c_str(), nullptr, nullptr);
+    worker->engine->Shutdown();
+  }
+  workers_.clear();
+
+  // Replies which arrive after this point are ignored.
+  std::map<uintptr_t, PendingJob> in_flight;
+  in_flight.swap(in_flight_);
+  for (auto& [id, pending] : in_flight) {
+    g_job_pools.erase(id);
+  }
+  std::deque<Job> queue;
+  queue.swap(queue_);
+  for (auto& [id, pending] : in_flight) {
+    stats_.failed++;
+    pending.callback(nullptr, 0);
+  }
+  for (Job& job : queue) {
+    stats_.failed++;
+    job.callback(nullptr, 0);
+  }
+}
+
+std::vector<FlutterEngine*> FlutterWorkerPool::GetEngines() {
+  std::vector<FlutterEngine*> engines;
+  for (std::shared_ptr<Worker>& worker : workers_) {
+    engines.push_back(worker->engine.get());
+  }
+  return engines;
+}
+
+void FlutterWorkerPool::Dispatch() {
+  while (!queue_.empty()) {
+    std::shared_ptr<Worker> worker = FindAvailableWorker();
+    if (!worker) {
+      return;
+    }
+    Job job = std::move(queue_.front());
+    queue_.pop_front();
+
+    uintptr_t id = g_next_job_id++;
+    in_flight_[id] = {worker, std::move(job.callback)};
+    g_job_pools[id] = this;
+    worker->jobs_in_flight++;
+    if (!FlutterDesktopMessengerSendWithReply(
+            worker->engine->GetMessenger(), channel_.c_str(),
+            job.message.data(), job.message.size(), OnJobReply,
+            reinterpret_cast<void*>(id))) {
+      TizenLog::Error("Could not send a job to a worker.");
+      worker->jobs_in_flight--;
+      stats_.failed++;
+      ResultCallback callback = std::move(in_flight_[id].callback);
+      in_flight_.erase(id);
+      g_job_pools.erase(id);
+      callback(nullptr, 0);
+    }
+  }
+}
+
+std::shared_ptr<FlutterWorkerPool::Worker>
+FlutterWorkerPool::FindAvailableWorker() {
+  std::shared_ptr<Worker> available;
+  for (std::shared_ptr<Worker>& worker : workers_) {
+    if (!worker->is_ready || worker->jobs_in_flight >= max_jobs_per_worker_) {
+      continue;
+    }
+    if (!available || worker->jobs_in_flight < available->jobs_in_flight) {
+      available = worker;
+    }
+  }
+  return available;
+}
+
+void FlutterWorkerPool::OnWorkerMessage(FlutterDesktopMessengerRef messenger,
+                                        const FlutterDesktopMessage* message,
+                                        void* user_data) {
+  auto* worker = static_cast<Worker*>(user_data);
+  FlutterDesktopMessengerSendResponse(messenger, message->response_handle,
+                                      nullptr, 0);
+  if (!worker->is_ready) {
+    worker->is_ready = true;
+    worker->pool->Dispatch();
+  }
+}
+
+void FlutterWorkerPool::OnJobReply(const uint8_t* data, size_t size,
+                                   void* user_data) {
+  auto id = reinterpret_cast<uintptr_t>(user_data);
+  auto pool_iter = g_job_pools.find(id);
+  if (pool_iter == g_job_pools.end()) {
+    // The job has already been completed by |Shutdown|.
+    return;
+  }
+  FlutterWorkerPool* pool = pool_iter->second;
+  g_job_pools.erase(pool_iter);
+  auto job_iter = pool->in_flight_.find(id);
+  std::shared_ptr<Worker> worker = std::move(job_iter->second.worker);
+  ResultCallback callback = std::move(job_iter->second.callback);
+  pool->in_flight_.erase(job_iter);
+  worker->jobs_in_flight--;
+  pool->stats_.completed++;
+  // Keep the worker busy while the result is being handled.
+  pool->Dispatch();
+  callback(data, size);
+}
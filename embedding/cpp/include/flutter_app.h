@@ -9,11 +9,20 @@
 #include <flutter/plugin_registry.h>
 #include <flutter_tizen.h>
 
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "flutter_app_control_coalescer.h"
 #include "flutter_engine.h"
+#include "flutter_engine_pool.h"
+#include "flutter_engine_threads.h"
+#include "flutter_frame_stats.h"
+#include "flutter_launch_timer.h"
+#include "flutter_page_cache.h"
+#include "flutter_watchdog.h"
 
 enum class FlutterRendererType {
   // The renderer based on EGL.
@@ -47,8 +56,20 @@ class FlutterApp : public flutter::PluginRegistry {
   virtual void OnAppControlReceived(app_control_h app_control);
 
   // Called when the system is running out of memory.
+  //
+  // Releases memory according to the memory pressure level and logs the
+  // memory usage of the main engine by category afterwards. See
+  // |FlutterMemoryPressure| for details.
   virtual void OnLowMemory(app_event_info_h event_info);
 
+  // Whether the view |view_id| created by |AddView| is released on a hard
+  // low memory warning.
+  //
+  // Returns false by default. Override to release views which are not
+  // visible, e.g. screens kept around for quick switching. A released view
+  // is destroyed as if by |RemoveView|.
+  virtual bool ShouldReleaseViewOnLowMemory(int view_id) { return false; }
+
   // Called when the device is running out of battery.
   virtual void OnLowBattery(app_event_info_h event_info) {}
 
@@ -67,10 +88,55 @@ class FlutterApp : public flutter::PluginRegistry {
   // Whether the app has started.
   bool IsRunning() { return view_ != nullptr; }
 
+  // Creates an additional engine and shows it in a new window.
+  //
+  // The engine runs |dart_entrypoint| (or main() if empty) in the same
+  // process as the main engine. The AOT library and the ICU data are loaded
+  // only once per process and shared by all engines. Lifecycle events
+  // received by the app are forwarded to all engines, while app controls are
+  // only delivered to the main engine.
+  //
+  // Must be called after |OnCreate|. Returns the ID of the new view, or -1
+  // if the view could not be created.
+  int AddView(const FlutterDesktopWindowProperties &window_prop,
+              const std::string &dart_entrypoint = "",
+              const std::vector<std::string> &dart_entrypoint_args = {});
+
+  // Destroys a view created by |AddView| and its engine.
+  void RemoveView(int view_id);
+
+  // Returns the engine of the view with |view_id|, or nullptr if there is no
+  // such view. The main view has the ID 0.
+  //
+  // The returned engine is a |flutter::PluginRegistry| which can be passed
+  // to |RegisterPlugins| to register plugins for an additional engine.
+  FlutterEngine *GetEngine(int view_id = 0);
+
   void SetDartEntrypoint(const std::string &entrypoint) {
     dart_entrypoint_ = entrypoint;
   }
 
+  // The pool which the engine of this app is taken from.
+  //
+  // Spare engines can be prepared in advance by calling
+  // |FlutterEnginePool::Prewarm|. Returns nullptr before |OnCreate| is
+  // called, unless |is_engine_preload_enabled_| is true.
+  FlutterEnginePool *GetEnginePool() { return engine_pool_.get(); }
+
+  // The counters of app controls coalesced so far.
+  //
+  // All counters are zero if |app_control_coalescing_window_| is not set.
+  FlutterAppControlCoalescer::Stats GetAppControlStats() {
+    return app_control_coalescer_ ? app_control_coalescer_->GetStats()
+                                  : FlutterAppControlCoalescer::Stats();
+  }
+
+  // The frame statistics of the main view.
+  //
+  // Returns nullptr unless |is_frame_stats_enabled_| is true and the app has
+  // started.
+  FlutterFrameStats *GetFrameStats() { return frame_stats_.get(); }
+
   // |flutter::PluginRegistry|
   FlutterDesktopPluginRegistrarRef GetRegistrarForPlugin(
       const std::string &plugin_name) override;
@@ -106,12 +172,16 @@ class FlutterApp : public flutter::PluginRegistry {
 
   // The renderer type of the engine.
   //
-  // Defaults to kEGL.
-  FlutterRendererType renderer_type_ = FlutterRendererType::kEGL;
+  // If unset, the renderer set by the engine profile is used, or kEGL if the
+  // profile sets none. A value set by the app takes precedence over the
+  // engine profile.
+  std::optional<FlutterRendererType> renderer_type_;
 
   // The user-defined pixel ratio.
   //
-  // Defaults to the device pixel ratio if the value is 0.
+  // Defaults to the pixel ratio set by the engine profile if the value is 0,
+  // or to the device pixel ratio if the profile sets none. A positive value
+  // takes precedence over the engine profile.
   double user_pixel_ratio_ = 0.0;
 
   // Whether the app should support pointing devices (mouse).
@@ -139,17 +209,159 @@ class FlutterApp : public flutter::PluginRegistry {
   FlutterDesktopUIThreadPolicy ui_thread_policy_ =
       FlutterDesktopUIThreadPolicy::kDefault;
 
+  // Whether to start preparing the engine before |OnCreate| is called.
+  //
+  // If true, engine arguments are parsed on a background thread as soon as
+  // |Run| is called, in parallel with the app framework initialization. The
+  // Dart entrypoint and |ui_thread_policy_| must not be changed after |Run|
+  // is called.
+  bool is_engine_preload_enabled_ = false;
+
+  // The time window in seconds for coalescing app controls.
+  //
+  // If positive, bursts of app controls are coalesced before they are
+  // delivered to the engine. See |FlutterAppControlCoalescer| for details.
+  // Defaults to 0, which delivers every app control immediately.
+  double app_control_coalescing_window_ = 0.0;
+
+  // Whether to stop non-essential work while the app is paused.
+  //
+  // The framework stops producing frames as soon as it is notified that the
+  // app is paused. If true, the embedding also stops waking the engine until
+  // |OnResume|:
+  //
+  //  - Language and region format changes are coalesced and delivered once
+  //    on resume.
+  //  - Every |FlutterExternalDataStream| drops data instead of posting it to
+  //    Dart.
+  //  - The frame statistics summary is not logged.
+  //
+  // In addition, the UI, raster and I/O threads of the engine run with
+  // |paused_thread_nice_value_|, and their original priority is restored on
+  // resume. A lower priority only yields the CPU to other processes when it
+  // is contended, and does not reduce the CPU time used on an otherwise idle
+  // CPU. Restoring the priority requires an RLIMIT_NICE which allows it (or
+  // the CAP_SYS_NICE capability), which apps do not have by default, so the
+  // threads are left as they are otherwise. See
+  // |FlutterEngineThrottler::IsSupported|. The CPU time used while paused is
+  // logged on resume.
+  //
+  // Dart timers and plugin event channels, which talk to the engine
+  // directly, keep running.
+  bool is_deep_pause_enabled_ = false;
+
+  // The nice value of engine threads while the app is paused.
+  //
+  // Only used if |is_deep_pause_enabled_| is true.
+  int paused_thread_nice_value_ = 19;
+
+  // The CPU affinity, priority and name of each engine thread.
+  //
+  // Applied once the engine has started. Raising the priority (a lower nice
+  // value or a real-time priority) requires privileges, and the settings of
+  // threads that cannot be changed are logged as errors. Empty by default,
+  // which leaves the threads as created by the engine.
+  FlutterEngineThreadConfig thread_config_;
+
+  // The time in seconds after which the platform thread is reported as
+  // stalled.
+  //
+  // If positive, a |FlutterWatchdog| monitors the platform thread while the
+  // app is running and logs a report when it stops responding. Defaults to 0,
+  // which disables the watchdog.
+  double watchdog_threshold_ = 0.0;
+
+  // Whether the watchdog also logs the native stack of the platform thread
+  // when it stalls.
+  //
+  // Only used if |watchdog_threshold_| is set. The stack is captured by
+  // interrupting the platform thread with SIGUSR2.
+  bool is_watchdog_stack_dump_enabled_ = false;
+
+  // Whether to read the app's Flutter files into the page cache at startup.
+  //
+  // If true, the pages of the AOT library, the ICU data and the assets which
+  // were resident after earlier launches are read on background threads as
+  // soon as |Run| is called. Every few launches are not warmed, and the
+  // profile of resident pages is updated shortly after them instead. See
+  // |FlutterPageCache| for details.
+  bool is_page_cache_warming_enabled_ = false;
+
+  // Whether to log the launch latency.
+  //
+  // If true, the time from the launch request to the end of |OnCreate| and
+  // to the first |OnResume| is logged, along with whether the launch was
+  // cold or warm. See |FlutterLaunchTimer| for details.
+  bool is_launch_timer_enabled_ = false;
+
+  // Whether to collect statistics on the frames of the main view.
+  //
+  // If true, the build and raster durations reported by the app over the
+  // "tizen/frame_timing" channel are collected by a |FlutterFrameStats|, and
+  // a new segment is started whenever the app is resumed. See
+  // |FlutterFrameStats| for the Dart code which reports the durations.
+  bool is_frame_stats_enabled_ = false;
+
+  // The interval in seconds at which a summary of the frame statistics is
+  // logged.
+  //
+  // Only used if |is_frame_stats_enabled_| is true. Defaults to 0, which
+  // disables the summary.
+  double frame_stats_log_interval_ = 0.0;
+
  private:
+  // A view created by |AddView|.
+  struct AdditionalView {
+    std::unique_ptr<FlutterEngine> engine;
+    FlutterDesktopViewRef view = nullptr;
+  };
+
+  // Returns the engines of all views, starting with the main engine.
+  std::vector<FlutterEngine *> GetEngines();
+
   // The optional entrypoint in the Dart project.
   //
   // Defaults to main() if the value is empty.
   std::string dart_entrypoint_;
 
+  // The pool which |engine_| is taken from.
+  std::unique_ptr<FlutterEnginePool> engine_pool_;
+
   // The Flutter engine instance.
   std::unique_ptr<FlutterEngine> engine_;
 
+  // Coalesces app controls if |app_control_coalescing_window_| is set.
+  std::unique_ptr<FlutterAppControlCoalescer> app_control_coalescer_;
+
+  // Monitors the platform thread if |watchdog_threshold_| is set.
+  std::unique_ptr<FlutterWatchdog> watchdog_;
+
+  // Warms the page cache if |is_page_cache_warming_enabled_| is true.
+  std::unique_ptr<FlutterPageCache> page_cache_;
+
+  // Collects frame statistics if |is_frame_stats_enabled_| is true.
+  std::unique_ptr<FlutterFrameStats> frame_stats_;
+
+  // Measures the launch latency if |is_launch_timer_enabled_| is true.
+  std::unique_ptr<FlutterLaunchTimer> launch_timer_;
+
   // The Flutter view instance handle.
   FlutterDesktopViewRef view_ = nullptr;
+
+  // The views created by |AddView|, keyed by view ID.
+  std::map<int, AdditionalView> additional_views_;
+
+  // The ID of the next view created by |AddView|.
+  int next_view_id_ = 1;
+
+  // Throttles engine threads while the app is paused.
+  FlutterEngineThrottler throttler_;
+
+  // Whether the app is paused with |is_deep_pause_enabled_| set.
+  bool is_deep_paused_ = false;
+
+  // Whether the locale has changed while deeply paused.
+  bool has_pending_locale_change_ = false;
 };
 
 #endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_APP_H_ */
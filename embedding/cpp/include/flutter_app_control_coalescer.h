@@ -0,0 +1,145 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_APP_CONTROL_COALESCER_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_APP_CONTROL_COALESCER_H_
+
+#include <Ecore.h>
+#include <app_control.h>
+#include <flutter_tizen.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Coalesces bursts of app controls before they are delivered to the engine.
+//
+// The first app control of a burst is delivered immediately. App controls
+// received within the coalescing window after it are held back, and those
+// with the same operation, URI, MIME type and extra data are collapsed into
+// the latest one. The remaining app controls are delivered together when the
+// window ends, in the order of their latest copies, and the window is
+// restarted as long as the burst continues.
+//
+// If a messenger is given, the Dart side can make the coalescer wait for it
+// by sending a message on the tizen/app_control_ack channel (see
+// enableAppControlBackPressure of the flutter_tizen package). From then on,
+// every delivery is followed by an empty message on that channel, and app
+// controls are held back and merged until the Dart side has replied to it,
+// so that a busy UI isolate receives one app control per duplicate rather
+// than a queue of them. If the Dart side does not reply within
+// |kMaxAwaitedWindows| windows, the held back app controls are delivered
+// anyway.
+//
+// App controls whose sender requested a reply are never held back, merged or
+// dropped. They are delivered immediately, after any app controls held back
+// before them. If more than |max_pending| app controls are held back, the
+// oldest one is dropped with a warning. All methods must be called on the
+// platform thread.
+class FlutterAppControlCoalescer {
+ public:
+  using DeliverCallback = std::function<void(app_control_h)>;
+
+  struct Stats {
+    // The number of app controls passed to |Add|.
+    uint64_t received = 0;
+    // The number of app controls passed to the deliver callback.
+    uint64_t delivered = 0;
+    // The number of app controls collapsed into a later duplicate.
+    uint64_t merged = 0;
+    // The number of app controls dropped because too many were pending.
+    uint64_t dropped = 0;
+    // The number of windows which ended while the Dart side had not replied
+    // to the last delivery.
+    uint64_t awaited_windows = 0;
+  };
+
+  // The number of windows to wait for the Dart side to reply before
+  // delivering held back app controls regardless.
+  static constexpr int kMaxAwaitedWindows = 50;
+
+  // Delivers app controls with |deliver|. If |messenger| is not null, the
+  // Dart side of its engine can enable back-pressure as described above.
+  explicit FlutterAppControlCoalescer(
+      DeliverCallback deliver, double window_seconds,
+      FlutterDesktopMessengerRef messenger = nullptr,
+      size_t max_pending = 32);
+  virtual ~FlutterAppControlCoalescer();
+
+  // Prevent copying.
+  FlutterAppControlCoalescer(FlutterAppControlCoalescer const &) = delete;
+  FlutterAppControlCoalescer &operator=(FlutterAppControlCoalescer const &) =
+      delete;
+
+  // Delivers |app_control| immediately or holds back a copy of it.
+  void Add(app_control_h app_control);
+
+  // Delivers all pending app controls immediately.
+  void Flush();
+
+  // The counters for the app controls handled so far.
+  const Stats &GetStats() const { return stats_; }
+
+ private:
+  struct PendingAppControl {
+    std::string key;
+    app_control_h app_control;
+  };
+
+  void Deliver(app_control_h app_control);
+
+  // Asks the Dart side to reply once it has handled what has been delivered,
+  // if back-pressure is enabled.
+  void RequestAck();
+
+  // Whether the Dart side has not replied to the last delivery yet.
+  bool IsAwaitingAck() const { return unacked_count_ > 0; }
+
+  // Called when the coalescing window ends.
+  static Eina_Bool OnWindowEnd(void *data);
+
+  // Called when the Dart side enables back-pressure.
+  static void OnMessage(FlutterDesktopMessengerRef messenger,
+                        const FlutterDesktopMessage *message,
+                        void *user_data);
+
+  // Called when the Dart side replies to |RequestAck|. |user_data| is the
+  // |id_| of the coalescer, which may have been destroyed meanwhile.
+  static void OnAckReply(const uint8_t *reply,
+                         size_t reply_size,
+                         void *user_data);
+
+  DeliverCallback deliver_;
+  double window_seconds_;
+  FlutterDesktopMessengerRef messenger_;
+  size_t max_pending_;
+
+  // Identifies this coalescer to |OnAckReply|.
+  uintptr_t id_;
+
+  // Whether the Dart side has enabled back-pressure.
+  bool is_back_pressure_enabled_ = false;
+
+  // The number of ack requests which the Dart side has not replied to.
+  size_t unacked_count_ = 0;
+
+  // The number of ack requests given up on by |OnWindowEnd|. Replies arrive
+  // in order, so the next replies are to these requests and are ignored.
+  size_t stale_ack_count_ = 0;
+
+  // The number of windows ended since the last ack request while awaiting
+  // a reply.
+  int awaited_windows_ = 0;
+
+  // The timer running while the coalescing window is open.
+  Ecore_Timer *timer_ = nullptr;
+
+  // The copies of app controls held back, in the order received.
+  std::vector<PendingAppControl> pending_;
+
+  Stats stats_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_APP_CONTROL_COALESCER_H_ */
@@ -0,0 +1,181 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_CHANNEL_BENCHMARK_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_CHANNEL_BENCHMARK_H_
+
+#include <flutter_tizen.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Measures the throughput and latency of platform channel messages.
+//
+// The benchmark works in both directions over a channel:
+//
+// - Dart to native: |RegisterEchoHandler| replies to every message on the
+//   channel with the same contents, so that Dart code can time round trips.
+// - Native to Dart: |Run| sends messages of each payload size one after
+//   another and times their round trips. The Dart side must echo them, e.g.
+//   with the entrypoint of package:flutter_tizen/benchmark.dart:
+//
+//     @pragma('vm:entry-point')
+//     void channelBenchmarkMain() => runChannelBenchmarkEcho();
+//
+// With |Codec::kBinary|, messages are the raw payload, as sent by a
+// BasicMessageChannel with BinaryCodec. With |Codec::kStandardMethod|, they
+// are "echo" method calls with the payload as a Uint8List argument, as sent
+// by a MethodChannel, which adds the cost of the standard codec on both
+// sides. runChannelBenchmarkEcho handles these on "tizen/benchmark/method".
+//
+// In |Mode::kLoopback|, messages are echoed back immediately without going
+// through the engine, which measures the native side cost alone. This works
+// without a running Dart entrypoint, e.g. in a headless |FlutterServiceApp|
+// on an emulator. All methods must be called on the platform thread.
+class FlutterChannelBenchmark {
+ public:
+  enum class Mode {
+    // Messages go through the engine to Dart and back.
+    kEngine,
+    // Messages are echoed back on the native side.
+    kLoopback,
+  };
+
+  enum class Codec {
+    // Messages are the payload itself.
+    kBinary,
+    // Messages are method calls encoded with the standard method codec.
+    kStandardMethod,
+  };
+
+  struct Result {
+    // The size of each message in bytes.
+    size_t payload_size = 0;
+    // The number of round trips completed.
+    size_t message_count = 0;
+    // The number of replies which did not match the message sent.
+    size_t error_count = 0;
+    double messages_per_second = 0.0;
+    double bytes_per_second = 0.0;
+    double p50_latency_ms = 0.0;
+    double p99_latency_ms = 0.0;
+  };
+
+  using CompletionCallback = std::function<void(const std::vector<Result>&)>;
+
+  // Creates a benchmark on |channel| of the engine which |registrar| belongs
+  // to. The registrar can be obtained from |GetRegistrarForPlugin|.
+  explicit FlutterChannelBenchmark(FlutterDesktopPluginRegistrarRef registrar,
+                                   const std::string& channel =
+                                       "tizen/benchmark",
+                                   Mode mode = Mode::kEngine,
+                                   Codec codec = Codec::kBinary);
+  virtual ~FlutterChannelBenchmark();
+
+  // Prevent copying.
+  FlutterChannelBenchmark(FlutterChannelBenchmark const&) = delete;
+  FlutterChannelBenchmark& operator=(FlutterChannelBenchmark const&) = delete;
+
+  // Replies to every message received on the channel with the same
+  // contents.
+  void RegisterEchoHandler();
+
+  // The number of messages echoed by the handler of |RegisterEchoHandler|.
+  size_t GetEchoCount() const { return echo_count_; }
+
+  // Sends |message_count| messages of each of |payload_sizes| bytes and
+  // calls |done| with one result per payload size.
+  //
+  // Results are also logged. Returns false if a run is already in progress
+  // or any payload size is 0, since an empty echo cannot be told apart from
+  // the empty reply sent when the Dart side has no handler. This object must
+  // outlive the run.
+  bool Run(const std::vector<size_t>& payload_sizes, size_t message_count,
+           CompletionCallback done);
+
+  // Whether |Run| is in progress.
+  bool IsRunning() const { return !!done_; }
+
+ private:
+  // Sends the next message, or finishes the current payload size.
+  void SendNext();
+
+  // Called with the echo of the message sent last.
+  void OnReply(const uint8_t* reply, size_t reply_size);
+
+  // Whether |reply| is the echo of the message sent last.
+  bool IsEcho(const uint8_t* reply, size_t reply_size) const;
+
+  // Returns the echo of |message|, or an empty vector if |message| is not
+  // an "echo" method call.
+  static std::vector<uint8_t> CreateMethodEcho(const uint8_t* message,
+                                               size_t message_size);
+
+  // Computes the result of the current payload size and moves to the next.
+  void FinishPayloadSize();
+
+  static void OnEchoMessage(FlutterDesktopMessengerRef messenger,
+                            const FlutterDesktopMessage* message,
+                            void* user_data);
+
+  static void OnReplyMessage(const uint8_t* reply, size_t reply_size,
+                             void* user_data);
+
+  // The messenger of the engine, referenced until this instance is
+  // destroyed.
+  FlutterDesktopMessengerRef messenger_;
+
+  // The channel which messages are sent over.
+  std::string channel_;
+
+  // Whether messages go through the engine.
+  Mode mode_;
+
+  // How messages are encoded.
+  Codec codec_;
+
+  // Whether |RegisterEchoHandler| has been called.
+  bool is_echo_registered_ = false;
+
+  // The number of messages echoed by the echo handler.
+  size_t echo_count_ = 0;
+
+  // The payload sizes to run, and the index of the current one.
+  std::vector<size_t> payload_sizes_;
+  size_t payload_index_ = 0;
+
+  // The number of round trips per payload size.
+  size_t message_count_ = 0;
+
+  // The payload of the message being sent.
+  std::vector<uint8_t> payload_;
+
+  // The method call carrying |payload_| in |Codec::kStandardMethod|.
+  std::vector<uint8_t> method_call_;
+
+  // The latency of each round trip of the current payload size.
+  std::vector<std::chrono::steady_clock::duration> latencies_;
+
+  // The number of mismatched replies for the current payload size.
+  size_t error_count_ = 0;
+
+  // The time when the current payload size and the current message started.
+  std::chrono::steady_clock::time_point payload_start_time_;
+  std::chrono::steady_clock::time_point send_time_;
+
+  // Whether |SendNext| is on the stack, and whether it must send again.
+  // Replies in |Mode::kLoopback| arrive synchronously, so the next message is
+  // sent from a loop instead of recursing.
+  bool is_sending_ = false;
+  bool is_send_pending_ = false;
+
+  // The results so far, and the callback to call when all are done.
+  std::vector<Result> results_;
+  CompletionCallback done_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_CHANNEL_BENCHMARK_H_ */
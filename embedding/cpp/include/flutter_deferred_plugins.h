@@ -0,0 +1,99 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_DEFERRED_PLUGINS_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_DEFERRED_PLUGINS_H_
+
+#include <Ecore.h>
+#include <flutter/plugin_registry.h>
+#include <flutter_tizen.h>
+
+#include <string>
+#include <vector>
+
+// Registers plugins after app startup instead of during |OnCreate|.
+//
+// Plugins added with |Defer| are registered one at a time when the main loop
+// is idle, starting |delay_seconds| after |ScheduleIdleRegistration| is
+// called, so that their native initialization does not delay the first
+// frame. A deferred plugin can also be registered right away with
+// |EnsureRegistered|, e.g. before a screen that uses it is shown. The time
+// taken to register each plugin is logged.
+//
+// The generated |ForEachPlugin| function can be used to defer all plugins:
+//
+//   bool OnCreate() {
+//     if (FlutterApp::OnCreate()) {
+//       deferred_plugins_ = std::make_unique<FlutterDeferredPlugins>(this);
+//       ForEachPlugin([this](const char *name, auto register_function) {
+//         deferred_plugins_->Defer(name, register_function);
+//       });
+//       deferred_plugins_->ScheduleIdleRegistration();
+//     }
+//     return IsRunning();
+//   }
+//
+// Messages sent from Dart to a plugin that is not registered yet fail with a
+// MissingPluginException, so plugins used by the first screen must not be
+// deferred. All methods must be called on the platform thread.
+class FlutterDeferredPlugins {
+ public:
+  using RegisterFunction = void (*)(FlutterDesktopPluginRegistrarRef);
+
+  explicit FlutterDeferredPlugins(flutter::PluginRegistry *registry);
+  virtual ~FlutterDeferredPlugins();
+
+  // Prevent copying.
+  FlutterDeferredPlugins(FlutterDeferredPlugins const &) = delete;
+  FlutterDeferredPlugins &operator=(FlutterDeferredPlugins const &) = delete;
+
+  // Registers the plugin named |name| immediately.
+  void Register(const std::string &name, RegisterFunction register_function);
+
+  // Adds the plugin named |name| to be registered later.
+  void Defer(const std::string &name, RegisterFunction register_function);
+
+  // Starts registering deferred plugins when the main loop is idle, after
+  // |delay_seconds|.
+  void ScheduleIdleRegistration(double delay_seconds = 0.0);
+
+  // Registers the deferred plugin named |name| if it is not registered yet.
+  //
+  // Returns false if no plugin named |name| has been added.
+  bool EnsureRegistered(const std::string &name);
+
+  // Registers all deferred plugins immediately.
+  void RegisterAll();
+
+  // Whether the plugin named |name| has been registered.
+  bool IsRegistered(const std::string &name) const;
+
+ private:
+  struct Plugin {
+    std::string name;
+    RegisterFunction register_function;
+    bool is_registered = false;
+  };
+
+  // Registers |plugin| and logs the time taken.
+  void RegisterPlugin(Plugin &plugin);
+
+  // Called when the delay of |ScheduleIdleRegistration| has passed.
+  static Eina_Bool OnDelayEnd(void *data);
+
+  // Called when the main loop is idle.
+  static Eina_Bool OnIdle(void *data);
+
+  // The registry which plugins are registered with.
+  flutter::PluginRegistry *registry_;
+
+  // The plugins added by |Register| and |Defer|.
+  std::vector<Plugin> plugins_;
+
+  // The timer and the idler running while registration is scheduled.
+  Ecore_Timer *delay_timer_ = nullptr;
+  Ecore_Idler *idler_ = nullptr;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_DEFERRED_PLUGINS_H_ */
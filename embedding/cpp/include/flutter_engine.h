@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "flutter_engine_arguments.h"
+#include "flutter_memory_stats.h"
 
 // The engine for Flutter execution.
 class FlutterEngine : public flutter::PluginRegistry {
@@ -54,6 +55,18 @@ class FlutterEngine : public flutter::PluginRegistry {
       FlutterDesktopUIThreadPolicy ui_thread_policy =
           FlutterDesktopUIThreadPolicy::kDefault);
 
+  // Creates a |FlutterEngine| with already parsed engine |arguments|.
+  //
+  // This allows multiple engines to share a single |FlutterEngineArguments|
+  // instance which may have been prepared ahead of time. See the other
+  // |Create| overload for the meaning of |ui_thread_policy|.
+  static std::unique_ptr<FlutterEngine> Create(
+      std::shared_ptr<const FlutterEngineArguments> arguments,
+      const std::string& dart_entrypoint = "",
+      const std::vector<std::string>& dart_entrypoint_args = {},
+      FlutterDesktopUIThreadPolicy ui_thread_policy =
+          FlutterDesktopUIThreadPolicy::kDefault);
+
   // Prevent copying.
   FlutterEngine(FlutterEngine const&) = delete;
   FlutterEngine& operator=(FlutterEngine const&) = delete;
@@ -61,6 +74,9 @@ class FlutterEngine : public flutter::PluginRegistry {
   // Starts running the engine.
   bool Run();
 
+  // Whether the engine has been started by |Run|.
+  bool IsRunning() const { return is_running_; }
+
   // Terminates the running engine.
   void Shutdown();
 
@@ -106,6 +122,20 @@ class FlutterEngine : public flutter::PluginRegistry {
   FlutterDesktopPluginRegistrarRef GetRegistrarForPlugin(
       const std::string& plugin_name) override;
 
+  // The messenger for sending messages to the Dart side of this engine.
+  //
+  // Returns nullptr if the engine could not be created or has been shut
+  // down.
+  FlutterDesktopMessengerRef GetMessenger();
+
+  // The memory accounting of the process running this engine.
+  //
+  // Created on the first call, so spare engines never register the memory
+  // usage channel. Samples include the size of the image cache once the
+  // Dart side of this engine reports it after the first call. Returns
+  // nullptr if the engine could not be created or has been shut down.
+  FlutterMemoryStats* GetMemoryStats();
+
   // The engine arguments instance containing parsed arguments and metadata
   // flags.
   const FlutterEngineArguments& GetArguments() const {
@@ -113,7 +143,8 @@ class FlutterEngine : public flutter::PluginRegistry {
   }
 
  private:
-  FlutterEngine(const std::string& assets_path,
+  FlutterEngine(std::shared_ptr<const FlutterEngineArguments> arguments,
+                const std::string& assets_path,
                 const std::string& icu_data_path,
                 const std::string& aot_library_path,
                 const std::string& dart_entrypoint,
@@ -126,8 +157,14 @@ class FlutterEngine : public flutter::PluginRegistry {
   // Whether or not this wrapper owns |engine_|.
   bool owns_engine_ = true;
 
+  // Whether or not |engine_| has been started by |Run|.
+  bool is_running_ = false;
+
   // The engine arguments instance.
-  std::unique_ptr<FlutterEngineArguments> engine_arguments_;
+  std::shared_ptr<const FlutterEngineArguments> engine_arguments_;
+
+  // The memory accounting of this engine, created by |GetMemoryStats|.
+  std::unique_ptr<FlutterMemoryStats> memory_stats_;
 };
 
 #endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_H_ */
@@ -8,9 +8,12 @@
 #include <app.h>
 #include <app_info.h>
 #include <app_manager.h>
+#include <flutter_tizen.h>
+#include <sys/stat.h>
 
 #include <cerrno>
-#include <map>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -33,19 +36,63 @@ class FlutterEngineArguments {
   // Whether the flutter gpu is enabled or not.
   bool IsFlutterGpuEnabled() const { return is_flutter_gpu_enabled_; }
 
+  // The pixel ratio of views set by the engine profile, if any.
+  std::optional<double> GetPixelRatio() const { return pixel_ratio_; }
+
+  // The renderer of views set by the engine profile, if any.
+  //
+  // A Vulkan renderer is dropped unless Impeller is enabled.
+  std::optional<FlutterDesktopRendererType> GetRendererType() const {
+    return renderer_type_;
+  }
+
+  // A boolean value read from the app metadata.
+  enum class MetadataValue : uint8_t {
+    kNotSet = 0,
+    kFalse = 1,
+    kTrue = 2,
+  };
+
+  // The app metadata values which affect engine arguments.
+  struct Metadata {
+    MetadataValue enable_impeller = MetadataValue::kNotSet;
+    MetadataValue enable_flutter_gpu = MetadataValue::kNotSet;
+  };
+
+  // Reads metadata from the cache file at |cache_path|.
+  //
+  // Returns false if the file does not exist, is malformed, or was written
+  // for a different |cache_key| or manifest.
+  static bool ReadMetadataCache(const std::string& cache_path,
+                                const std::string& cache_key,
+                                const struct stat& manifest_stat,
+                                Metadata& metadata);
+
+  // Writes |metadata| to the cache file at |cache_path|.
+  static void WriteMetadataCache(const std::string& cache_path,
+                                 const std::string& cache_key,
+                                 const struct stat& manifest_stat,
+                                 const Metadata& metadata);
+
  private:
   // Reads engine arguments passed from the flutter-tizen tool.
   std::vector<std::string> ParseEngineArgs();
 
-  // Reads metadata from tizen-manifest.xml
-  std::map<std::string, std::string> GetMetadata(const std::string& app_id);
+  // Reads metadata from tizen-manifest.xml, or from the metadata cache if it
+  // is up to date.
+  Metadata GetMetadata(const std::string& app_id);
+
+  // Reads metadata from tizen-manifest.xml.
+  Metadata ReadMetadata(const std::string& app_id);
+
+  // Adds the switches and settings of the engine profile in the app's res
+  // directory, if any. Switches already in |engine_args| take precedence.
+  void ApplyEngineProfile(std::vector<std::string>& engine_args);
 
   // Processes a metadata flag by checking both engine arguments and application
   // metadata.
   bool ProcessMetadataFlag(std::vector<std::string>& engine_args,
-                           const std::string& flag,
-                           const std::string& metadata_key,
-                           const std::map<std::string, std::string>& metadata);
+                           const std::string& flag, MetadataValue value);
 
   // The list of parsed engine arguments.
   std::vector<std::string> engine_args_;
@@ -55,6 +102,12 @@ class FlutterEngineArguments {
 
   // Whether the flutter gpu is enabled or not.
   bool is_flutter_gpu_enabled_ = false;
+
+  // The pixel ratio set by the engine profile.
+  std::optional<double> pixel_ratio_;
+
+  // The renderer type set by the engine profile.
+  std::optional<FlutterDesktopRendererType> renderer_type_;
 };
 
 #endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_ARGUMENTS_H_ */
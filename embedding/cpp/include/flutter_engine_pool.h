@@ -0,0 +1,115 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_POOL_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_POOL_H_
+
+#include <flutter_tizen.h>
+
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter_engine.h"
+#include "flutter_engine_arguments.h"
+
+// Prepares engines ahead of time so that they can be handed out later
+// without paying the creation cost on the critical path of app startup.
+//
+// Engine arguments are parsed only once per pool (optionally on a background
+// thread, see |PreloadArguments|) and shared by all engines created by the
+// pool. Every other method must be called on the platform thread, because
+// an engine is bound to the thread it was created on.
+class FlutterEnginePool {
+ public:
+  explicit FlutterEnginePool(
+      const std::string& dart_entrypoint = "",
+      const std::vector<std::string>& dart_entrypoint_args = {},
+      FlutterDesktopUIThreadPolicy ui_thread_policy =
+          FlutterDesktopUIThreadPolicy::kDefault);
+  virtual ~FlutterEnginePool();
+
+  // Prevent copying.
+  FlutterEnginePool(FlutterEnginePool const&) = delete;
+  FlutterEnginePool& operator=(FlutterEnginePool const&) = delete;
+
+  // Starts parsing engine arguments on a background thread.
+  //
+  // This can be called before the app main loop starts so that parsing
+  // overlaps with the app framework initialization. Has no effect if the
+  // arguments are already available or being parsed.
+  void PreloadArguments();
+
+  // Creates engines until the pool holds at least |count| spare engines.
+  //
+  // If |run| is true, the spare engines are also started and kept apart from
+  // the others, since a view can only be created for an engine which has not
+  // been started. Running spare engines are only handed out by
+  // |AcquireRunning|.
+  //
+  // Returns the number of spare engines of the requested kind in the pool.
+  size_t Prewarm(size_t count = 1, bool run = false);
+
+  // Takes a spare engine which has not been started out of the pool, or
+  // creates a new engine if there is none.
+  //
+  // The engine can be passed to FlutterDesktopViewCreateFromNewWindow.
+  // Returns nullptr if an engine could not be created.
+  std::unique_ptr<FlutterEngine> Acquire();
+
+  // Takes a spare engine which has not been started out of the pool if it
+  // has been prepared with the same entrypoint and entrypoint arguments, or
+  // creates a new engine which shares the engine arguments of this pool.
+  //
+  // Returns nullptr if an engine could not be created.
+  std::unique_ptr<FlutterEngine> Acquire(
+      const std::string& dart_entrypoint,
+      const std::vector<std::string>& dart_entrypoint_args);
+
+  // Takes a running spare engine out of the pool, or creates and starts a
+  // new engine if there is none.
+  //
+  // The engine is headless and cannot be shown in a view. Returns nullptr if
+  // an engine could not be created or started.
+  std::unique_ptr<FlutterEngine> AcquireRunning();
+
+  // The number of spare engines in the pool which have not been started.
+  size_t GetSpareCount() const { return engines_.size(); }
+
+  // The number of running spare engines in the pool.
+  size_t GetRunningSpareCount() const { return running_engines_.size(); }
+
+  // Destroys all spare engines in the pool.
+  void Clear();
+
+  // Returns the shared engine arguments, waiting for |PreloadArguments| to
+  // complete if necessary.
+  std::shared_ptr<const FlutterEngineArguments> GetArguments();
+
+ private:
+  // The optional entrypoint in the Dart project.
+  std::string dart_entrypoint_;
+
+  // The optional entrypoint arguments.
+  std::vector<std::string> dart_entrypoint_args_;
+
+  // The thread policy for running the UI isolate.
+  FlutterDesktopUIThreadPolicy ui_thread_policy_;
+
+  // The engine arguments shared by all engines created by this pool.
+  std::shared_ptr<const FlutterEngineArguments> arguments_;
+
+  // The pending result of |PreloadArguments|.
+  std::future<std::shared_ptr<const FlutterEngineArguments>>
+      arguments_future_;
+
+  // The spare engines which have not been started.
+  std::vector<std::unique_ptr<FlutterEngine>> engines_;
+
+  // The spare engines which have been started by |Prewarm|.
+  std::vector<std::unique_ptr<FlutterEngine>> running_engines_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_POOL_H_ */
@@ -0,0 +1,81 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_PROFILE_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_PROFILE_H_
+
+#include <flutter_tizen.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+// The characteristics of a device which engine profile rules are matched
+// against.
+struct FlutterDeviceInfo {
+  // The total physical memory in MiB.
+  int64_t memory_mb = 0;
+
+  // The number of CPU cores.
+  int64_t cpu_count = 0;
+
+  // The device profile which the embedding was built for (e.g. "tv" or
+  // "common").
+  std::string profile;
+
+  // Returns the characteristics of the current device.
+  static FlutterDeviceInfo Get();
+};
+
+// The engine settings chosen for a device by engine profile rules.
+struct FlutterEngineProfileSettings {
+  // Engine switches (e.g. "--old-gen-heap-size=256").
+  std::vector<std::string> switches;
+
+  // The pixel ratio of views, if set.
+  std::optional<double> pixel_ratio;
+
+  // The renderer of views, if set.
+  std::optional<FlutterDesktopRendererType> renderer_type;
+};
+
+// Evaluates engine profile rules, which tune the engine to the device the
+// app is running on.
+//
+// Rules are read from a file in the app's res directory. Each rule starts
+// with a list of conditions in brackets, followed by the settings applied if
+// all of the conditions hold:
+//
+//   # Comments start with '#'.
+//   [memory_mb < 1024]
+//   --old-gen-heap-size=128
+//   --resource-cache-max-bytes-threshold=33554432
+//   pixel_ratio = 1.0
+//
+//   [profile == tv, memory_mb >= 2048, cpu_count >= 4]
+//   --old-gen-heap-size=512
+//   renderer = vulkan
+//
+// A condition compares |memory_mb|, |cpu_count| or |profile| with a value
+// using one of ==, !=, <, <=, > and >=. An empty list of conditions always
+// holds. Rules are evaluated in order, so a setting or switch of a later rule
+// replaces the same one of an earlier rule.
+class FlutterEngineProfile {
+ public:
+  // Evaluates the rules in the file at |path| for |device| into |settings|.
+  //
+  // Returns false and sets |error| if the file is invalid. Returns true
+  // without changing |settings| if the file does not exist.
+  static bool Evaluate(const std::string& path,
+                       const FlutterDeviceInfo& device,
+                       FlutterEngineProfileSettings& settings,
+                       std::string& error);
+
+ private:
+  explicit FlutterEngineProfile() {}
+  virtual ~FlutterEngineProfile() {}
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_PROFILE_H_ */
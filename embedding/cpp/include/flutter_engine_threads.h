@@ -0,0 +1,185 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_THREADS_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_THREADS_H_
+
+#include <sys/types.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum class FlutterEngineThreadType {
+  // The main thread of the app.
+  kPlatform,
+  // The thread running the UI isolate, if it is not the platform thread.
+  kUI,
+  // The thread rasterizing frames.
+  kRaster,
+  // The thread performing I/O and decoding images.
+  kIO,
+};
+
+// A thread owned by the Flutter engine.
+struct FlutterEngineThread {
+  pid_t tid;
+  FlutterEngineThreadType type;
+  std::string name;
+};
+
+// The scheduling settings of an engine thread.
+//
+// Unset values are left unchanged.
+struct FlutterEngineThreadSettings {
+  // The CPUs the thread may run on, where bit N stands for CPU N.
+  std::optional<uint64_t> cpu_affinity_mask;
+
+  // The nice value of the thread (-20 to 19) under the normal scheduling
+  // policy. Values lower than the current one require privileges.
+  std::optional<int> nice_value;
+
+  // The priority of the thread (1 to 99) under the SCHED_FIFO real-time
+  // scheduling policy. Requires privileges. Cannot be combined with
+  // |nice_value|.
+  std::optional<int> realtime_priority;
+
+  // The name of the thread, at most 15 characters.
+  std::optional<std::string> name;
+};
+
+// The scheduling settings of each engine thread.
+//
+// If the UI isolate runs on the platform thread, |ui| is ignored.
+struct FlutterEngineThreadConfig {
+  FlutterEngineThreadSettings platform;
+  FlutterEngineThreadSettings ui;
+  FlutterEngineThreadSettings raster;
+  FlutterEngineThreadSettings io;
+
+  // Whether any setting is set.
+  bool IsEmpty() const;
+
+  // Checks the settings against the limits of this device.
+  //
+  // Returns false and sets |error| if any setting is invalid.
+  bool Validate(std::string &error) const;
+};
+
+// Where an engine thread is currently scheduled.
+struct FlutterEngineThreadPlacement {
+  FlutterEngineThread thread;
+  // The CPUs the thread may run on, where bit N stands for CPU N.
+  uint64_t cpu_affinity_mask;
+  // The CPU the thread last ran on.
+  int last_cpu;
+  // The scheduling policy (e.g. SCHED_OTHER or SCHED_FIFO).
+  int policy;
+  // The nice value under the normal scheduling policy.
+  int nice_value;
+  // The priority under a real-time scheduling policy.
+  int realtime_priority;
+};
+
+// Utilities for the threads of the Flutter engines running in this process.
+class FlutterEngineThreads {
+ public:
+  // Finds engine threads by their names (e.g. "1.ui", "1.raster" and
+  // "1.io"). The platform thread is always included.
+  //
+  // If there are multiple engines in the process, the threads of all engines
+  // are returned.
+  static std::vector<FlutterEngineThread> Find();
+
+  // Applies |config| to the engine threads found by |Find|.
+  //
+  // Must be called after the engine has started, since the threads do not
+  // exist before. Returns false if any setting could not be applied.
+  static bool Apply(const FlutterEngineThreadConfig &config);
+
+  // Returns the current placement of the engine threads found by |Find|.
+  static std::vector<FlutterEngineThreadPlacement> GetPlacement();
+
+  // Returns the CPU time consumed by this process so far.
+  static std::chrono::milliseconds GetProcessCpuTime();
+
+ private:
+  explicit FlutterEngineThreads() {}
+  virtual ~FlutterEngineThreads() {}
+};
+
+// Lowers the scheduling priority of engine threads while an app is in the
+// background, and restores it when the app comes back.
+//
+// The platform thread is never throttled because it must keep responding to
+// the app framework.
+class FlutterEngineThrottler {
+ public:
+  // The CPU time used by the process while throttled.
+  struct PauseStats {
+    // The time from |Throttle| to |Restore|.
+    std::chrono::milliseconds elapsed{0};
+    // The CPU time consumed by all threads of the process in that time.
+    std::chrono::milliseconds cpu_time{0};
+
+    // The CPU time as a fraction of the elapsed time of one CPU.
+    double GetCpuUsage() const {
+      return elapsed.count() > 0
+                 ? static_cast<double>(cpu_time.count()) / elapsed.count()
+                 : 0.0;
+    }
+  };
+
+  explicit FlutterEngineThrottler() {}
+  virtual ~FlutterEngineThrottler() {}
+
+  // Prevent copying.
+  FlutterEngineThrottler(FlutterEngineThrottler const &) = delete;
+  FlutterEngineThrottler &operator=(FlutterEngineThrottler const &) = delete;
+
+  // Whether the priority of the engine threads can be restored after they
+  // have been throttled.
+  //
+  // Lowering a nice value back requires the CAP_SYS_NICE capability or an
+  // RLIMIT_NICE which allows it. Apps have neither by default. A thread
+  // under SCHED_IDLE is treated as nice 20, so switching it back to
+  // SCHED_OTHER has the same requirement.
+  static bool IsSupported();
+
+  // Sets the nice value of the UI, raster and I/O threads to |nice_value|.
+  //
+  // Threads whose priority could not be restored are not throttled.
+  void Throttle(int nice_value);
+
+  // Restores the original nice values and logs the CPU time consumed while
+  // throttled.
+  void Restore();
+
+  // Whether |Throttle| has been called without a matching |Restore|.
+  bool IsThrottled() const { return is_throttled_; }
+
+  // The CPU time used while throttled, as of the latest |Restore|.
+  const PauseStats &GetLastPauseStats() const { return last_pause_stats_; }
+
+ private:
+  // Whether the engine threads are currently throttled.
+  bool is_throttled_ = false;
+
+  // The throttled threads and their original nice values.
+  std::vector<std::pair<pid_t, int>> original_nice_values_;
+
+  // The time when |Throttle| was called.
+  std::chrono::steady_clock::time_point throttle_time_;
+
+  // The process CPU time when |Throttle| was called.
+  std::chrono::milliseconds throttle_cpu_time_{0};
+
+  // The result of the latest |Restore|.
+  PauseStats last_pause_stats_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ENGINE_THREADS_H_ */
@@ -0,0 +1,129 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_EXTERNAL_DATA_STREAM_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_EXTERNAL_DATA_STREAM_H_
+
+#include <flutter_tizen.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Streams bulk data (e.g. camera frames or sensor samples) from native code
+// to Dart without copying it.
+//
+// The stream owns a fixed number of buffers. The producer fills a buffer
+// returned by |AcquireBuffer| and hands it to Dart with |Post|. Dart receives
+// the buffer itself as a Uint8List backed by external typed data, and the
+// buffer becomes available again once the Uint8List is garbage collected.
+// If all buffers are still held by Dart, |AcquireBuffer| returns nullptr and
+// the producer should drop the data.
+//
+// Dart connects to a stream by sending the address of the Dart API table
+// and the native port of a ReceivePort over the "tizen/external_data"
+// channel, followed by the UTF-8 name of the stream:
+//
+//   final port = ReceivePort()..listen((data) => onData(data as Uint8List));
+//   final name = utf8.encode('camera');
+//   final message = ByteData(16 + name.length)
+//     ..setInt64(0, NativeApi.initializeApiDLData.address, Endian.host)
+//     ..setInt64(8, port.sendPort.nativePort, Endian.host);
+//   message.buffer.asUint8List(16).setAll(0, name);
+//   await const BasicMessageChannel<ByteData?>(
+//       'tizen/external_data', BinaryCodec()).send(message);
+//
+// Sending 0 as the native port disconnects the stream. |AcquireBuffer|,
+// |ReleaseBuffer| and |Post| can be called on any thread. Other methods must
+// be called on the platform thread.
+class FlutterExternalDataStream {
+ public:
+  struct Stats {
+    // The number of buffers handed to Dart.
+    uint64_t posted = 0;
+    // The number of times no buffer was available, including while paused.
+    uint64_t dropped = 0;
+  };
+
+  // Creates a stream named |name| with |buffer_count| buffers of
+  // |buffer_size| bytes each.
+  //
+  // |messenger| is the messenger of the engine running the Dart side, which
+  // can be obtained from |FlutterEngine::GetMessenger| or
+  // FlutterDesktopPluginRegistrarGetMessenger. Returns nullptr if a stream
+  // with the same name already exists for |messenger|.
+  static std::unique_ptr<FlutterExternalDataStream> Create(
+      FlutterDesktopMessengerRef messenger, const std::string& name,
+      size_t buffer_size, size_t buffer_count = 3);
+
+  virtual ~FlutterExternalDataStream();
+
+  // Prevent copying.
+  FlutterExternalDataStream(FlutterExternalDataStream const&) = delete;
+  FlutterExternalDataStream& operator=(FlutterExternalDataStream const&) =
+      delete;
+
+  // Makes all streams drop data while |paused|.
+  //
+  // Used while the app is in the background, so that producers do not wake
+  // the Dart side. |AcquireBuffer| returns nullptr until unpaused, and
+  // buffers already acquired can still be posted.
+  static void SetPaused(bool paused);
+
+  // Whether Dart is listening to this stream.
+  bool IsConnected() const;
+
+  // The size of each buffer in bytes.
+  size_t GetBufferSize() const;
+
+  // Takes a free buffer of |GetBufferSize| bytes.
+  //
+  // Returns nullptr if Dart is not listening, streams are paused or all
+  // buffers are in use.
+  uint8_t* AcquireBuffer();
+
+  // Returns a buffer taken by |AcquireBuffer| without posting it.
+  void ReleaseBuffer(uint8_t* buffer);
+
+  // Hands the first |size| bytes of |buffer| to Dart.
+  //
+  // |buffer| must have been returned by |AcquireBuffer| and must not be
+  // accessed afterwards. Returns false if the buffer could not be posted, in
+  // which case it is released.
+  bool Post(uint8_t* buffer, size_t size);
+
+  // The counters for the buffers handled so far.
+  Stats GetStats() const;
+
+ private:
+  // The state shared with the buffers held by Dart.
+  struct State;
+
+  // Identifies a buffer held by Dart.
+  struct BufferPeer;
+
+  FlutterExternalDataStream(FlutterDesktopMessengerRef messenger,
+                            std::shared_ptr<State> state);
+
+  // Returns the index of |buffer|, or -1 if it does not belong to this
+  // stream.
+  int GetBufferIndex(const uint8_t* buffer) const;
+
+  // Called when Dart no longer references a buffer.
+  static void OnBufferFinalized(void* isolate_callback_data, void* peer);
+
+  // Called when a message is received on the connection channel.
+  static void OnConnectMessage(FlutterDesktopMessengerRef messenger,
+                               const FlutterDesktopMessage* message,
+                               void* user_data);
+
+  // The messenger which this stream is registered with, referenced until
+  // the stream is destroyed.
+  FlutterDesktopMessengerRef messenger_;
+
+  // The buffers and the port of the Dart side.
+  std::shared_ptr<State> state_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_EXTERNAL_DATA_STREAM_H_ */
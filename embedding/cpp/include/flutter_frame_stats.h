@@ -0,0 +1,153 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_FRAME_STATS_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_FRAME_STATS_H_
+
+#include <Ecore.h>
+#include <flutter_tizen.h>
+
+#include <array>
+#include <cstdint>
+
+// Collects statistics on the frames rendered by an engine.
+//
+// The engine reports frame timings only to the framework, so the app sends
+// them over the "tizen/frame_timing" channel as an Int64List of three values
+// per frame: the build duration, the raster duration and the total span, all
+// in microseconds.
+//
+//   SchedulerBinding.instance.addTimingsCallback((timings) {
+//     final data = Int64List(timings.length * 3);
+//     for (var i = 0; i < timings.length; i++) {
+//       data[i * 3] = timings[i].buildDuration.inMicroseconds;
+//       data[i * 3 + 1] = timings[i].rasterDuration.inMicroseconds;
+//       data[i * 3 + 2] = timings[i].totalSpan.inMicroseconds;
+//     }
+//     const BasicMessageChannel<Object?>(
+//         'tizen/frame_timing', StandardMessageCodec()).send(data);
+//   });
+//
+// Durations are counted in fixed-size histograms, so adding a frame does
+// not allocate. A frame is janky if its build or raster phase takes longer
+// than the frame budget, and overruns the vsync if its total span does.
+// Statistics are kept both since the stats were created and since the
+// latest |StartSegment|, which the app calls whenever it is resumed.
+//
+// All methods must be called on the platform thread.
+class FlutterFrameStats {
+ public:
+  enum class Phase {
+    // The time spent by the UI thread to build the frame.
+    kBuild,
+    // The time spent by the raster thread to render the frame.
+    kRaster,
+    // The time from the vsync signal to the end of rasterization.
+    kTotal,
+  };
+
+  enum class Segment {
+    // Since the stats were created.
+    kLifetime,
+    // Since the latest |StartSegment|.
+    kCurrent,
+  };
+
+  // Starts receiving frame timings from the engine of |messenger|.
+  //
+  // |frame_budget_us| is the time available for each frame, which is 16667
+  // microseconds at 60 Hz.
+  explicit FlutterFrameStats(FlutterDesktopMessengerRef messenger,
+                             int64_t frame_budget_us = 16667);
+  virtual ~FlutterFrameStats();
+
+  // Prevent copying.
+  FlutterFrameStats(FlutterFrameStats const &) = delete;
+  FlutterFrameStats &operator=(FlutterFrameStats const &) = delete;
+
+  // Counts a frame. All durations are in microseconds.
+  void AddFrame(int64_t build_us, int64_t raster_us, int64_t total_us);
+
+  // Resets the statistics of |Segment::kCurrent|.
+  void StartSegment();
+
+  // Returns the duration in milliseconds within which |percentile| percent
+  // of the frames of |segment| completed |phase|, e.g. 90 for p90.
+  //
+  // The result is rounded up to the resolution of the histogram, which is
+  // 0.5 ms. Returns 0 if no frames have been counted.
+  double GetPercentile(Phase phase, double percentile,
+                       Segment segment = Segment::kCurrent) const;
+
+  // The number of frames of |segment|.
+  uint64_t GetFrameCount(Segment segment = Segment::kCurrent) const;
+
+  // The number of janky frames of |segment|.
+  uint64_t GetJankCount(Segment segment = Segment::kCurrent) const;
+
+  // The number of frames of |segment| which overran the vsync.
+  uint64_t GetVsyncOverrunCount(Segment segment = Segment::kCurrent) const;
+
+  // Logs a summary of |Segment::kCurrent| every |interval_seconds|.
+  //
+  // Nothing is logged for intervals without frames. A non-positive
+  // |interval_seconds| stops logging.
+  void SetLogInterval(double interval_seconds);
+
+  // Logs a summary of |segment|.
+  void LogSummary(Segment segment = Segment::kCurrent) const;
+
+ private:
+  // The width of a histogram bucket in microseconds.
+  static constexpr int64_t kBucketWidthUs = 500;
+
+  // The number of buckets. The last bucket counts all frames longer than
+  // the range of the others.
+  static constexpr size_t kBucketCount = 201;
+
+  struct Histogram {
+    std::array<uint32_t, kBucketCount> buckets = {};
+    // The longest duration counted, in microseconds.
+    int64_t max_us = 0;
+  };
+
+  struct SegmentStats {
+    std::array<Histogram, 3> histograms;
+    uint64_t frame_count = 0;
+    uint64_t jank_count = 0;
+    uint64_t vsync_overrun_count = 0;
+  };
+
+  static void AddToHistogram(Histogram &histogram, int64_t duration_us);
+
+  const SegmentStats &GetSegment(Segment segment) const;
+
+  // Called when a message is received on the frame timing channel.
+  static void OnMessage(FlutterDesktopMessengerRef messenger,
+                        const FlutterDesktopMessage *message,
+                        void *user_data);
+
+  // Called every log interval.
+  static Eina_Bool OnLogTimer(void *data);
+
+  // The messenger which the channel is registered with.
+  FlutterDesktopMessengerRef messenger_;
+
+  // The time available for each frame in microseconds.
+  int64_t frame_budget_us_;
+
+  // The statistics since the stats were created.
+  SegmentStats lifetime_;
+
+  // The statistics since the latest |StartSegment|.
+  SegmentStats current_;
+
+  // The number of frames of |current_| at the latest periodic summary.
+  uint64_t last_logged_frame_count_ = 0;
+
+  // The timer running while periodic summaries are enabled.
+  Ecore_Timer *log_timer_ = nullptr;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_FRAME_STATS_H_ */
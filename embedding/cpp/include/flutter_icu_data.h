@@ -0,0 +1,51 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ICU_DATA_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ICU_DATA_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Locates an ICU data file shared by all Flutter apps on the device.
+//
+// Every app bundles its own copy of icudtl.dat. If the same data is
+// installed in one of the shared directories, as
+// "icudtl-<checksum>.dat" where <checksum> is the 16-digit hex checksum of
+// the bundled file, the shared file is used instead so that its pages in the
+// page cache are shared between all running Flutter apps. The engine maps
+// the file read-only, so no private copies are made.
+//
+// Since the checksum covers the whole file, a shared file is only used by
+// apps built with the same engine revision. The bundled file is only read to
+// compute its checksum if a shared directory has an ICU data file of the same
+// size. The checksums of the bundled and shared files are cached in the app's
+// data directory, keyed by their size and modification time, so the files
+// are only read in full once.
+class FlutterIcuData {
+ public:
+  // Returns the path of a shared ICU data file identical to the file at
+  // |bundled_path|, or |bundled_path| if there is none.
+  static std::string Resolve(const std::string& bundled_path);
+
+  // Returns the path of a shared ICU data file identical to the file at
+  // |bundled_path| in one of |shared_directories|, or |bundled_path| if
+  // there is none.
+  //
+  // |cache_path| is the file where checksums are cached, or empty to disable
+  // caching.
+  static std::string Resolve(const std::string& bundled_path,
+                             const std::vector<std::string>& shared_directories,
+                             const std::string& cache_path);
+
+  // Returns the checksum of the file at |path|, or 0 if it cannot be read.
+  static uint64_t ComputeChecksum(const std::string& path);
+
+ private:
+  explicit FlutterIcuData() {}
+  virtual ~FlutterIcuData() {}
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_ICU_DATA_H_ */
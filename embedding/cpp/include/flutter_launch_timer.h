@@ -0,0 +1,75 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_LAUNCH_TIMER_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_LAUNCH_TIMER_H_
+
+#include <cstdint>
+
+// Measures the launch latency of the app and whether the launch was cold or
+// warm.
+//
+// The launch starts when the launch request was sent, as recorded by AUL in
+// the launch bundle. Apps are usually started by a launchpad loader process
+// which was forked ahead of time, so the start time of the process does not
+// tell when the launch started. If the bundle has no start time, the launch
+// is measured from |Start|.
+//
+// A launch is warm if most of the AOT library was already in the page cache
+// when the app started, e.g. because the app was closed only recently, and
+// cold otherwise. Cold launches are dominated by reading the app from
+// storage, so the two are reported separately.
+class FlutterLaunchTimer {
+ public:
+  struct Result {
+    // The time from the start of the launch to the end of |OnCreate|.
+    int64_t create_milliseconds = -1;
+    // The time from the start of the launch to |Finish|.
+    int64_t launch_milliseconds = -1;
+    // Whether the launch is measured from the launch request rather than
+    // from |Start|.
+    bool is_from_launch_request = false;
+    // The fraction of the AOT library that was in the page cache at |Start|,
+    // or a negative value if unknown.
+    double cached_ratio = -1.0;
+    // Whether the launch was warm.
+    bool is_warm = false;
+  };
+
+  FlutterLaunchTimer() = default;
+  virtual ~FlutterLaunchTimer() = default;
+
+  // Prevent copying.
+  FlutterLaunchTimer(FlutterLaunchTimer const &) = delete;
+  FlutterLaunchTimer &operator=(FlutterLaunchTimer const &) = delete;
+
+  // Reads the start of the launch from the launch bundle in |argv| and
+  // checks whether the launch is warm.
+  //
+  // Must be called with the arguments of main(), before the engine is
+  // created and before the page cache is warmed.
+  void Start(int argc, char **argv);
+
+  // Records the end of |OnCreate|.
+  void MarkCreated();
+
+  // Records the end of the launch and logs the result. Only the first call
+  // has an effect.
+  void Finish();
+
+  // The result of the launch, valid after |Finish| is called.
+  const Result &GetResult() const { return result_; }
+
+ private:
+  // The result being measured.
+  Result result_;
+
+  // The start of the launch in milliseconds since the epoch.
+  int64_t start_time_ = 0;
+
+  // Whether |Finish| has been called.
+  bool is_finished_ = false;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_LAUNCH_TIMER_H_ */
@@ -0,0 +1,70 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_MEMORY_PRESSURE_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_MEMORY_PRESSURE_H_
+
+#include <app_common.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "flutter_engine.h"
+#include "flutter_engine_pool.h"
+
+enum class FlutterMemoryPressureLevel {
+  // The memory status has returned to normal.
+  kNormal,
+  // The system is running low on memory.
+  kSoft,
+  // The system is about to kill apps to reclaim memory.
+  kHard,
+};
+
+// Reclaims memory in tiers when the system is running out of memory.
+//
+// On a soft warning, engine caches are purged and the Dart heap is trimmed.
+// On a hard warning, spare engines are released as well, and |FlutterApp|
+// first releases the views chosen by
+// |FlutterApp::ShouldReleaseViewOnLowMemory|. Reclaim callbacks registered
+// by the app or plugins run last, in order of priority.
+//
+// The memory released is not measured here, since the engine releases most
+// of it asynchronously on its own threads. The memory usage after
+// reclaiming is logged by |FlutterMemoryStats| instead.
+class FlutterMemoryPressure {
+ public:
+  using ReclaimCallback = std::function<void(FlutterMemoryPressureLevel)>;
+
+  // Reads the memory pressure level from a low memory event.
+  static FlutterMemoryPressureLevel GetLevel(app_event_info_h event_info);
+
+  // Registers a callback which releases memory when the memory pressure
+  // reaches |min_level|.
+  //
+  // Callbacks with a smaller |priority| run first. |name| is used in logs.
+  // This method is thread-safe. Returns an ID which can be passed to
+  // |RemoveReclaimCallback|.
+  static int AddReclaimCallback(const std::string &name, int priority,
+                                FlutterMemoryPressureLevel min_level,
+                                ReclaimCallback callback);
+
+  // Unregisters a callback registered by |AddReclaimCallback|.
+  static void RemoveReclaimCallback(int id);
+
+  // Releases memory held by |engines|, |pool| and registered callbacks
+  // according to |level|.
+  //
+  // Must be called on the platform thread. |pool| can be nullptr.
+  static void Reclaim(FlutterMemoryPressureLevel level,
+                      const std::vector<FlutterEngine *> &engines,
+                      FlutterEnginePool *pool);
+
+ private:
+  explicit FlutterMemoryPressure() {}
+  virtual ~FlutterMemoryPressure() {}
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_MEMORY_PRESSURE_H_ */
@@ -0,0 +1,169 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_MEMORY_STATS_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_MEMORY_STATS_H_
+
+#include <Ecore.h>
+#include <flutter_tizen.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The memory used by the process, by category.
+//
+// All sizes are proportional set sizes in bytes, so memory shared with
+// other processes (e.g. pages of a system library) is divided among them.
+struct FlutterMemoryUsage {
+  // The time of the sample in milliseconds since an arbitrary point.
+  int64_t timestamp_ms = 0;
+
+  // The total memory of the process.
+  int64_t total = 0;
+
+  // The Dart heap.
+  //
+  // Only measured if the kernel supports naming anonymous mappings, which
+  // the Dart VM uses to label its heap. Otherwise the Dart heap is counted
+  // as |native_heap|.
+  int64_t dart_heap = 0;
+
+  // GPU buffers and textures mapped into the process.
+  int64_t gpu = 0;
+
+  // The AOT library (libapp.so).
+  int64_t aot_library = 0;
+
+  // The ICU data.
+  int64_t icu_data = 0;
+
+  // The code and data of the engine and the embedder.
+  int64_t engine_library = 0;
+
+  // The code and data of the plugin libraries of the app.
+  int64_t plugin_libraries = 0;
+
+  // The memory allocated by native code, including plugins and the
+  // renderer.
+  int64_t native_heap = 0;
+
+  // The memory which does not belong to any of the other categories.
+  int64_t other = 0;
+
+  // The size of the image cache reported by the Dart side of the engine, or
+  // -1 if not reported.
+  //
+  // Decoded images are held in the Dart heap, the native heap or GPU memory
+  // depending on the renderer, so this overlaps with the other categories
+  // and is not counted in |total|.
+  int64_t image_cache = -1;
+};
+
+// Accounts for the memory used by the process running an engine.
+//
+// Memory is sampled from /proc/self/smaps and each mapping is attributed to
+// a category of |FlutterMemoryUsage| by its name. Sampling takes a few
+// milliseconds for a typical app, so samples are only taken on demand or at
+// the interval set by |SetRecordInterval|. The latest samples are kept in a
+// time series of fixed capacity.
+//
+// The size of the image cache is not visible in the mappings, so the Dart
+// side of the engine can report it over the "tizen/memory_usage" channel:
+//
+//   Timer.periodic(const Duration(seconds: 10), (_) {
+//     const BasicMessageChannel<Object?>(
+//         'tizen/memory_usage', StandardMessageCodec())
+//         .send(PaintingBinding.instance.imageCache.currentSizeBytes);
+//   });
+//
+// All methods must be called on the platform thread.
+class FlutterMemoryStats {
+ public:
+  // Creates an instance which receives reports from the engine of
+  // |messenger| and keeps up to |capacity| samples.
+  //
+  // |messenger| can be nullptr, in which case the image cache is not
+  // reported. |proc_path| is the /proc directory of the process to sample,
+  // which can be changed to sample another process, e.g. "/proc/1234" when
+  // testing on a Linux host.
+  explicit FlutterMemoryStats(FlutterDesktopMessengerRef messenger,
+                              size_t capacity = 60,
+                              const std::string& proc_path = "/proc/self");
+  virtual ~FlutterMemoryStats();
+
+  // Prevent copying.
+  FlutterMemoryStats(FlutterMemoryStats const&) = delete;
+  FlutterMemoryStats& operator=(FlutterMemoryStats const&) = delete;
+
+  // Samples the current memory usage.
+  FlutterMemoryUsage Sample() const;
+
+  // Samples the current memory usage and adds it to the time series,
+  // replacing the oldest sample if full.
+  FlutterMemoryUsage Record();
+
+  // Records a sample every |interval_seconds|. A non-positive
+  // |interval_seconds| stops recording.
+  void SetRecordInterval(double interval_seconds);
+
+  // The recorded samples, from the oldest to the latest.
+  std::vector<FlutterMemoryUsage> GetTimeSeries() const;
+
+  // The recorded samples as text, one line per sample.
+  //
+  // Each line contains the timestamp in milliseconds followed by the sizes
+  // of the categories in KiB, in the order given by the first line:
+  //
+  //   # time total dart gpu aot icu engine plugins native other images
+  //   52113 98304 20480 8192 6144 2048 14336 1024 40960 5120 4096
+  std::string ExportTimeSeries() const;
+
+  // Logs |usage| by category.
+  static void Log(const FlutterMemoryUsage& usage);
+
+  // Reads the memory usage of the process from the smaps file at
+  // |smaps_path| into |usage|.
+  //
+  // Shared libraries in |plugin_directory| are counted as plugin libraries
+  // unless empty. Returns false if the file cannot be read.
+  static bool ReadSmaps(const std::string& smaps_path,
+                        const std::string& plugin_directory,
+                        FlutterMemoryUsage& usage);
+
+ private:
+  // Called when a message is received on the memory usage channel.
+  static void OnMessage(FlutterDesktopMessengerRef messenger,
+                        const FlutterDesktopMessage* message,
+                        void* user_data);
+
+  // Called every record interval.
+  static Eina_Bool OnRecordTimer(void* data);
+
+  // The messenger which the channel is registered with, or nullptr.
+  FlutterDesktopMessengerRef messenger_;
+
+  // The /proc directory of the sampled process.
+  std::string proc_path_;
+
+  // The directory of the plugin libraries of the app.
+  std::string plugin_directory_;
+
+  // The latest image cache size reported by the Dart side, or -1.
+  int64_t image_cache_ = -1;
+
+  // The recorded samples, used as a ring buffer once full.
+  std::vector<FlutterMemoryUsage> samples_;
+
+  // The maximum number of samples.
+  size_t capacity_;
+
+  // The index of the oldest sample once |samples_| is full.
+  size_t oldest_index_ = 0;
+
+  // The timer running while samples are recorded periodically.
+  Ecore_Timer* record_timer_ = nullptr;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_MEMORY_STATS_H_ */
@@ -0,0 +1,205 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_PAGE_CACHE_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_PAGE_CACHE_H_
+
+#include <Ecore.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Reads the pages of the app's Flutter files into the page cache ahead of
+// time.
+//
+// On the first launch after boot, most of the startup time is spent on page
+// faults into the AOT library, the ICU data and the assets. This class
+// records which pages of those files are resident after a launch into a
+// profile, and on later launches reads the recorded pages on background
+// threads with readahead() while the app framework and the engine are being
+// initialized.
+//
+// Pages read by warming are resident whether or not the launch used them,
+// so launches which were warmed are never recorded. Instead, every
+// |kRecordingInterval|-th launch is not warmed and is recorded. Each page of
+// the profile has an age, the number of consecutive recordings in which it
+// was not resident, and is removed from the profile once its age reaches
+// |kMaxPageAge|.
+//
+// The profile is a text file listing each file with its size and
+// modification time, followed by ranges of page indices with their ages. A
+// file whose size or modification time has changed (e.g. after an update) is
+// dropped from the profile and recorded again.
+class FlutterPageCache {
+ public:
+  // The result of |StartWarming|.
+  struct WarmingStats {
+    // The number of pages listed in the profile for files which are valid.
+    size_t profiled_pages = 0;
+    // The number of those pages that were already in the page cache. A high
+    // ratio means that the launch would have been warm anyway.
+    size_t cached_pages = 0;
+    // The time spent on warming.
+    int64_t elapsed_milliseconds = 0;
+  };
+
+  // The result of |Record|.
+  struct RecordingStats {
+    // The number of resident pages of the recorded files.
+    size_t resident_pages = 0;
+    // The number of those pages that were already in the profile. The ratio
+    // to |resident_pages| is the hit rate of the profile for this launch.
+    size_t profiled_pages = 0;
+    // The number of pages removed from the profile since they have not been
+    // resident for |kMaxPageAge| recordings.
+    size_t removed_pages = 0;
+  };
+
+  // One in this many launches is not warmed so that it can be recorded.
+  static constexpr size_t kRecordingInterval = 8;
+
+  // The number of consecutive recordings in which a page must not be
+  // resident to be removed from the profile.
+  static constexpr uint32_t kMaxPageAge = 3;
+
+  // The delay after |OnCreate| of an app before recording, by which time
+  // the app has usually loaded the code and assets it needs at launch.
+  static constexpr double kRecordingDelaySeconds = 10.0;
+
+  // Creates an instance which reads and writes the profile at
+  // |profile_path|.
+  explicit FlutterPageCache(const std::string &profile_path);
+  virtual ~FlutterPageCache();
+
+  // Prevent copying.
+  FlutterPageCache(FlutterPageCache const &) = delete;
+  FlutterPageCache &operator=(FlutterPageCache const &) = delete;
+
+  // Returns the path of the default profile in the app's data directory.
+  static std::string GetDefaultProfilePath();
+
+  // Returns the AOT library, the ICU data and the asset files of the app,
+  // relative to the working directory as used by |FlutterEngine::Create|.
+  static std::vector<std::string> GetDefaultFiles();
+
+  // Returns the fraction of the pages of the file at |path| that are in the
+  // page cache, or a negative value if the file cannot be read.
+  static double GetCachedRatio(const std::string &path);
+
+  // Starts reading the pages listed in the profile on |thread_count|
+  // background threads.
+  //
+  // Returns false if there is no valid profile to warm from, or if this
+  // launch is to be recorded instead (see |kRecordingInterval|).
+  bool StartWarming(size_t thread_count = 4);
+
+  // Blocks until warming started by |StartWarming| has finished and returns
+  // its result.
+  //
+  // The result is also logged by the last warming thread to finish, so this
+  // only needs to be called if the app has to wait for warming.
+  WarmingStats WaitForWarming();
+
+  // Adds the pages of |files| that are currently resident to the profile,
+  // ages the pages that are not, and logs the hit rate of the previous
+  // profile.
+  //
+  // Files which are not in |files| are removed from the profile. Must not be
+  // called after |StartWarming| has returned true, since the pages read by
+  // warming would be counted as used.
+  bool Record(const std::vector<std::string> &files,
+              RecordingStats *stats = nullptr);
+
+  // Calls |Record| with |GetDefaultFiles| on a background thread after
+  // |delay_seconds|, unless this launch has been warmed by |StartWarming|.
+  //
+  // Must be called on the platform thread.
+  void ScheduleRecording(double delay_seconds);
+
+ private:
+  // A range of page indices within a file.
+  struct PageRange {
+    uint32_t start;
+    uint32_t count;
+    // The number of consecutive recordings in which the pages were not
+    // resident.
+    uint32_t age = 0;
+  };
+
+  // The pages recorded for a file.
+  struct FileProfile {
+    std::string path;
+    int64_t size = 0;
+    int64_t modification_time = 0;
+    std::vector<PageRange> ranges;
+  };
+
+  // The contents of a profile.
+  struct Profile {
+    // The number of launches warmed since the latest recording.
+    size_t warmed_launches = 0;
+    std::vector<FileProfile> files;
+  };
+
+  // A range of pages to be read by a warming thread.
+  struct WarmingTask {
+    size_t file_index;
+    PageRange range;
+  };
+
+  // Reads the profile from |profile_path_|, dropping files which have
+  // changed since they were recorded.
+  Profile ReadProfile();
+
+  // Writes |profile| to |profile_path_|.
+  bool WriteProfile(const Profile &profile);
+
+  // Reads the ranges of |tasks_| until none are left.
+  void RunWarmingTasks();
+
+  // Called when the delay of |ScheduleRecording| has passed.
+  static Eina_Bool OnRecordingDelayEnd(void *data);
+
+  // The path of the profile.
+  std::string profile_path_;
+
+  // The profile being warmed from.
+  Profile warming_profile_;
+
+  // The ranges of |warming_profile_| split into tasks.
+  std::vector<WarmingTask> tasks_;
+
+  // Whether this launch has been warmed by |StartWarming|.
+  bool is_warmed_ = false;
+
+  // The index of the next task in |tasks_| to be run.
+  std::atomic<size_t> next_task_{0};
+
+  // The number of pages found in the page cache by warming threads.
+  std::atomic<size_t> cached_pages_{0};
+
+  // The number of warming threads which have not finished yet.
+  std::atomic<size_t> running_threads_{0};
+
+  // The result of warming, set by the last warming thread to finish.
+  WarmingStats warming_stats_;
+
+  // The threads running |RunWarmingTasks|.
+  std::vector<std::thread> warming_threads_;
+
+  // The time when |StartWarming| was called.
+  int64_t warming_start_time_ = 0;
+
+  // The timer running while recording is scheduled.
+  Ecore_Timer *recording_timer_ = nullptr;
+
+  // The thread running |Record| after |ScheduleRecording|.
+  std::thread recording_thread_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_PAGE_CACHE_H_ */
@@ -13,7 +13,14 @@
 #include <string>
 #include <vector>
 
+#include "flutter_app_control_coalescer.h"
 #include "flutter_engine.h"
+#include "flutter_engine_pool.h"
+#include "flutter_engine_threads.h"
+#include "flutter_launch_timer.h"
+#include "flutter_page_cache.h"
+#include "flutter_watchdog.h"
+#include "flutter_worker_pool.h"
 
 // The app base class for headless Flutter execution.
 class FlutterServiceApp : public flutter::PluginRegistry {
@@ -34,6 +41,10 @@ class FlutterServiceApp : public flutter::PluginRegistry {
   virtual void OnAppControlReceived(app_control_h app_control);
 
   // Called when the system is running out of memory.
+  //
+  // Logs the memory usage of the main engine by category and releases
+  // memory according to the memory pressure level. See
+  // |FlutterMemoryPressure| for details.
   virtual void OnLowMemory(app_event_info_h event_info);
 
   // Called when the device is running out of battery.
@@ -55,6 +66,38 @@ class FlutterServiceApp : public flutter::PluginRegistry {
     dart_entrypoint_ = entrypoint;
   }
 
+  // The pool which the engine of this app is taken from.
+  //
+  // Spare engines can be prepared and started in advance by calling
+  // |FlutterEnginePool::Prewarm| with |run| set to true. Returns nullptr
+  // before |OnCreate| is called, unless |is_engine_preload_enabled_| is true.
+  FlutterEnginePool *GetEnginePool() { return engine_pool_.get(); }
+
+  // The counters of app controls coalesced so far.
+  //
+  // All counters are zero if |app_control_coalescing_window_| is not set.
+  FlutterAppControlCoalescer::Stats GetAppControlStats() {
+    return app_control_coalescer_ ? app_control_coalescer_->GetStats()
+                                  : FlutterAppControlCoalescer::Stats();
+  }
+
+  // Spawns |count| headless worker engines running |dart_entrypoint| with
+  // |dart_entrypoint_args|.
+  //
+  // Workers run Dart code in parallel with the main engine and each other.
+  // Jobs are sent to them through |GetWorkerPool|. Can be called multiple
+  // times with different entrypoints after |OnCreate|, and all workers are
+  // shut down on |OnTerminate|. Returns the number of workers spawned.
+  size_t SpawnWorkers(
+      size_t count, const std::string &dart_entrypoint,
+      const std::vector<std::string> &dart_entrypoint_args = {});
+
+  // The pool which schedules jobs across the workers spawned by
+  // |SpawnWorkers|.
+  //
+  // Returns nullptr if no worker has been spawned.
+  FlutterWorkerPool *GetWorkerPool() { return worker_pool_.get(); }
+
   // |flutter::PluginRegistry|
   FlutterDesktopPluginRegistrarRef GetRegistrarForPlugin(
       const std::string &plugin_name) override;
@@ -67,14 +110,89 @@ class FlutterServiceApp : public flutter::PluginRegistry {
   FlutterDesktopUIThreadPolicy ui_thread_policy_ =
       FlutterDesktopUIThreadPolicy::kDefault;
 
+  // Whether to start preparing the engine before |OnCreate| is called.
+  //
+  // If true, engine arguments are parsed on a background thread as soon as
+  // |Run| is called, in parallel with the app framework initialization. The
+  // Dart entrypoint and |ui_thread_policy_| must not be changed after |Run|
+  // is called.
+  bool is_engine_preload_enabled_ = false;
+
+  // The time window in seconds for coalescing app controls.
+  //
+  // If positive, bursts of app controls are coalesced before they are
+  // delivered to the engine. See |FlutterAppControlCoalescer| for details.
+  // Defaults to 0, which delivers every app control immediately.
+  double app_control_coalescing_window_ = 0.0;
+
+  // The CPU affinity, priority and name of each engine thread.
+  //
+  // Applied once the engine has started. Raising the priority (a lower nice
+  // value or a real-time priority) requires privileges, and the settings of
+  // threads that cannot be changed are logged as errors. Empty by default,
+  // which leaves the threads as created by the engine.
+  FlutterEngineThreadConfig thread_config_;
+
+  // The time in seconds after which the platform thread is reported as
+  // stalled.
+  //
+  // If positive, a |FlutterWatchdog| monitors the platform thread while the
+  // app is running and logs a report when it stops responding. Defaults to 0,
+  // which disables the watchdog.
+  double watchdog_threshold_ = 0.0;
+
+  // Whether the watchdog also logs the native stack of the platform thread
+  // when it stalls.
+  //
+  // Only used if |watchdog_threshold_| is set. The stack is captured by
+  // interrupting the platform thread with SIGUSR2.
+  bool is_watchdog_stack_dump_enabled_ = false;
+
+  // Whether to read the app's Flutter files into the page cache at startup.
+  //
+  // If true, the pages of the AOT library, the ICU data and the assets which
+  // were resident after earlier launches are read on background threads as
+  // soon as |Run| is called. Every few launches are not warmed, and the
+  // profile of resident pages is updated shortly after them instead. See
+  // |FlutterPageCache| for details.
+  bool is_page_cache_warming_enabled_ = false;
+
+  // Whether to log the launch latency.
+  //
+  // If true, the time from the launch request to the end of |OnCreate| is
+  // logged, along with whether the launch was cold or warm. See
+  // |FlutterLaunchTimer| for details.
+  bool is_launch_timer_enabled_ = false;
+
  private:
+  // Returns the main engine and the engines of all workers.
+  std::vector<FlutterEngine *> GetEngines();
+
   // The optional entrypoint in the Dart project.
   //
   // Defaults to main() if the value is empty.
   std::string dart_entrypoint_;
 
+  // The pool which |engine_| is taken from.
+  std::unique_ptr<FlutterEnginePool> engine_pool_;
+
   // The Flutter engine instance.
   std::unique_ptr<FlutterEngine> engine_;
+
+  // Coalesces app controls if |app_control_coalescing_window_| is set.
+  std::unique_ptr<FlutterAppControlCoalescer> app_control_coalescer_;
+
+  // Monitors the platform thread if |watchdog_threshold_| is set.
+  std::unique_ptr<FlutterWatchdog> watchdog_;
+
+  // Warms the page cache if |is_page_cache_warming_enabled_| is true.
+  std::unique_ptr<FlutterPageCache> page_cache_;
+
+  // Measures the launch latency if |is_launch_timer_enabled_| is true.
+  std::unique_ptr<FlutterLaunchTimer> launch_timer_;
+
+  // The worker engines spawned by |SpawnWorkers|.
+  std::unique_ptr<FlutterWorkerPool> worker_pool_;
 };
 
 #endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_SERVICE_APP_H_ */
@@ -0,0 +1,173 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_STANDARD_MESSAGE_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_STANDARD_MESSAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// The type of a value encoded with the standard message codec.
+enum class FlutterStandardType : uint8_t {
+  kNull = 0,
+  kTrue = 1,
+  kFalse = 2,
+  kInt32 = 3,
+  kInt64 = 4,
+  kLargeInt = 5,
+  kFloat64 = 6,
+  kString = 7,
+  kUint8List = 8,
+  kInt32List = 9,
+  kInt64List = 10,
+  kFloat64List = 11,
+  kList = 12,
+  kMap = 13,
+  kFloat32List = 14,
+};
+
+// A value read by |FlutterStandardMessageReader|.
+//
+// Strings and typed lists are views into the message being read, so they
+// are only valid as long as the message buffer is.
+struct FlutterStandardValue {
+  FlutterStandardType type = FlutterStandardType::kNull;
+
+  // The value of kTrue, kFalse, kInt32 and kInt64.
+  int64_t int_value = 0;
+
+  // The value of kFloat64.
+  double double_value = 0.0;
+
+  // The contents of kString, kLargeInt and typed lists.
+  const uint8_t* data = nullptr;
+
+  // The number of bytes of kString and kLargeInt, the number of elements of
+  // typed lists and kList, and the number of entries of kMap.
+  size_t length = 0;
+
+  // Returns the contents of kString or kLargeInt.
+  std::string_view AsString() const {
+    return std::string_view(reinterpret_cast<const char*>(data), length);
+  }
+
+  // Returns the elements of a typed list of |T|, or nullptr if |data| is not
+  // aligned for |T|.
+  //
+  // Elements are aligned relative to the start of the message, so this
+  // returns nullptr for a message buffer which is not aligned to 8 bytes.
+  // Copy the elements out of |data| with memcpy in that case.
+  template <typename T>
+  const T* AsTypedList() const {
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+      return nullptr;
+    }
+    return reinterpret_cast<const T*>(data);
+  }
+};
+
+// Reads a message encoded with the standard message codec without copying
+// or allocating.
+//
+// Values are read in order. After a kList value is read, its elements follow
+// as the next |length| values. After a kMap value is read, its entries follow
+// as the next |length| pairs of a key and a value. Use |Skip| to skip a value
+// including all of its elements.
+class FlutterStandardMessageReader {
+ public:
+  explicit FlutterStandardMessageReader(const uint8_t* data, size_t size)
+      : data_(data), size_(size) {}
+  virtual ~FlutterStandardMessageReader() {}
+
+  // Reads the next value into |value|.
+  //
+  // Returns false if the message is malformed or there are no more values.
+  bool Read(FlutterStandardValue& value);
+
+  // Skips the next value and, for lists and maps, all of their elements.
+  //
+  // A message which ends inside a list or a map is malformed.
+  bool Skip();
+
+  // Whether all values have been read.
+  bool IsAtEnd() const { return offset_ >= size_; }
+
+  // Whether a malformed value has been found.
+  bool HasError() const { return has_error_; }
+
+ private:
+  bool ReadSize(size_t& size);
+  bool ReadAlignment(size_t alignment);
+  const uint8_t* ReadBytes(size_t length);
+
+  // Reads the contents of a typed list of |element_size| bytes per element.
+  bool ReadTypedList(size_t element_size, FlutterStandardValue& value);
+
+  // Marks the message as malformed and returns false.
+  bool Fail();
+
+  const uint8_t* data_;
+  size_t size_;
+
+  // The position of the next value.
+  size_t offset_ = 0;
+
+  // Whether a malformed value has been found.
+  bool has_error_ = false;
+};
+
+// Writes a message in the standard message codec format.
+//
+// Typed lists are written with a single copy and aligned as expected by the
+// Dart side, which can then view them without copying again. Lists and maps
+// are written by |BeginList| or |BeginMap| followed by their elements.
+class FlutterStandardMessageWriter {
+ public:
+  explicit FlutterStandardMessageWriter(size_t capacity = 0) {
+    buffer_.reserve(capacity);
+  }
+  virtual ~FlutterStandardMessageWriter() {}
+
+  void WriteNull();
+  void WriteBool(bool value);
+
+  // Writes |value| as kInt32 if it fits in 32 bits, or as kInt64 otherwise.
+  void WriteInt(int64_t value);
+
+  void WriteDouble(double value);
+  void WriteString(std::string_view value);
+  void WriteUint8List(const uint8_t* data, size_t length);
+  void WriteInt32List(const int32_t* data, size_t length);
+  void WriteInt64List(const int64_t* data, size_t length);
+  void WriteFloat32List(const float* data, size_t length);
+  void WriteFloat64List(const double* data, size_t length);
+
+  // Starts a list of |length| elements, which must be written next.
+  void BeginList(size_t length);
+
+  // Starts a map of |length| entries, whose keys and values must be written
+  // next in turn.
+  void BeginMap(size_t length);
+
+  // The message written so far.
+  const std::vector<uint8_t>& GetBuffer() const { return buffer_; }
+
+  // Takes the message written so far and resets the writer.
+  std::vector<uint8_t> TakeBuffer();
+
+ private:
+  void WriteType(FlutterStandardType type);
+  void WriteSize(size_t size);
+  void WriteAlignment(size_t alignment);
+  void WriteBytes(const void* data, size_t length);
+  void WriteTypedList(FlutterStandardType type, const void* data,
+                      size_t length, size_t element_size);
+
+  // The encoded message.
+  std::vector<uint8_t> buffer_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_STANDARD_MESSAGE_H_ */
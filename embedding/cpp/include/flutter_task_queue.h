@@ -0,0 +1,121 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_TASK_QUEUE_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_TASK_QUEUE_H_
+
+#include <flutter_tizen.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Runs tasks on background threads.
+//
+// A serial queue runs one task at a time in the order posted. A concurrent
+// queue runs up to |GetThreadCount| tasks at a time.
+class FlutterTaskQueue {
+ public:
+  enum class Type {
+    kSerial,
+    kConcurrent,
+  };
+
+  // Creates a queue of |type|.
+  //
+  // |thread_count| is only used by concurrent queues, and defaults to the
+  // number of CPUs if zero.
+  explicit FlutterTaskQueue(Type type = Type::kSerial, size_t thread_count = 0);
+
+  // Waits for the running tasks to finish. Tasks not started yet are
+  // discarded.
+  virtual ~FlutterTaskQueue();
+
+  // Prevent copying.
+  FlutterTaskQueue(FlutterTaskQueue const&) = delete;
+  FlutterTaskQueue& operator=(FlutterTaskQueue const&) = delete;
+
+  // Posts |task| to run on a thread of this queue.
+  void Post(std::function<void()> task);
+
+  // The number of threads running tasks.
+  size_t GetThreadCount() const { return threads_.size(); }
+
+  // Posts |task| to run on the platform thread. Can be called on any thread.
+  static void PostToPlatformThread(std::function<void()> task);
+
+ private:
+  // Runs tasks until the queue is destroyed.
+  void RunTasks();
+
+  // The threads running tasks.
+  std::vector<std::thread> threads_;
+
+  // Guards |tasks_| and |is_shutting_down_|.
+  std::mutex mutex_;
+  std::condition_variable condition_;
+
+  // The tasks not started yet, in the order posted.
+  std::deque<std::function<void()>> tasks_;
+
+  // Whether the queue is being destroyed.
+  bool is_shutting_down_ = false;
+};
+
+// Handles messages on a channel on a |FlutterTaskQueue| instead of the
+// platform thread.
+//
+// This keeps the platform thread free to respond to the app framework while
+// plugins do blocking work, similar to BinaryMessenger.TaskQueue on Android.
+// The reply can be sent from any thread and is delivered on the platform
+// thread. If the handler drops the reply without calling it, an empty reply
+// is sent.
+class FlutterBackgroundChannel {
+ public:
+  using Reply = std::function<void(const uint8_t* reply, size_t reply_size)>;
+  using Handler = std::function<void(const uint8_t* message,
+                                     size_t message_size, Reply reply)>;
+
+  // Registers |handler| for |channel| of |messenger|. The messenger can be
+  // obtained from FlutterDesktopPluginRegistrarGetMessenger.
+  //
+  // |task_queue| may be shared by multiple channels.
+  explicit FlutterBackgroundChannel(
+      FlutterDesktopMessengerRef messenger, const std::string& channel,
+      std::shared_ptr<FlutterTaskQueue> task_queue, Handler handler);
+
+  // Unregisters the handler. Messages already posted to the task queue are
+  // still handled.
+  virtual ~FlutterBackgroundChannel();
+
+  // Prevent copying.
+  FlutterBackgroundChannel(FlutterBackgroundChannel const&) = delete;
+  FlutterBackgroundChannel& operator=(FlutterBackgroundChannel const&) =
+      delete;
+
+ private:
+  // Called on the platform thread when a message is received.
+  static void OnMessage(FlutterDesktopMessengerRef messenger,
+                        const FlutterDesktopMessage* message,
+                        void* user_data);
+
+  // The messenger which the handler is registered with.
+  FlutterDesktopMessengerRef messenger_;
+
+  // The channel which the handler is registered for.
+  std::string channel_;
+
+  // The queue which messages are handled on.
+  std::shared_ptr<FlutterTaskQueue> task_queue_;
+
+  // The handler, shared with the messages being handled.
+  std::shared_ptr<Handler> handler_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_TASK_QUEUE_H_ */
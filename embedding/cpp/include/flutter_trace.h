@@ -0,0 +1,90 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_TRACE_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_TRACE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Tracing is compiled in for debug builds only. Define
+// FLUTTER_TIZEN_ENABLE_TRACE to keep it in release builds.
+#if !defined(NDEBUG) || defined(FLUTTER_TIZEN_ENABLE_TRACE)
+#define FLUTTER_TIZEN_TRACE_ENABLED 1
+#endif
+
+// Records app lifecycle and engine phases with monotonic timestamps.
+//
+// Events are stored in a fixed-size lock-free ring buffer, so recording never
+// allocates or blocks. When the buffer is full, the oldest events are
+// overwritten. Use the FLUTTER_TRACE_* macros below instead of calling
+// |Record| directly so that the calls compile out when tracing is disabled.
+class FlutterTrace {
+ public:
+  enum class Phase : char {
+    kBegin = 'B',
+    kEnd = 'E',
+    kInstant = 'i',
+  };
+
+  // The maximum number of events kept in the buffer.
+  static constexpr size_t kCapacity = 1024;
+
+  // Records an event for the calling thread.
+  //
+  // |name| must have static storage duration (e.g. a string literal).
+  static void Record(const char *name, Phase phase);
+
+  // Returns the recorded events in the Chrome trace event JSON format, which
+  // can be loaded into chrome://tracing or Perfetto.
+  static std::string ExportChromeTraceJson();
+
+  // Returns the recorded events in a compact binary format.
+  //
+  // The format is a "FTRC" magic, a uint32 version and a uint32 event count,
+  // followed by the events. Each event consists of a uint64 timestamp in
+  // nanoseconds, a uint32 thread ID, a phase character, a uint8 name length
+  // and the name. All integers are little-endian.
+  static std::vector<uint8_t> ExportBinary();
+
+  // Writes the result of |ExportChromeTraceJson| or |ExportBinary| to |path|.
+  static bool WriteToFile(const std::string &path, bool binary = false);
+
+ private:
+  explicit FlutterTrace() {}
+  virtual ~FlutterTrace() {}
+};
+
+// Records a begin event on construction and an end event on destruction.
+class FlutterTraceScope {
+ public:
+  explicit FlutterTraceScope(const char *name) : name_(name) {
+    FlutterTrace::Record(name_, FlutterTrace::Phase::kBegin);
+  }
+  ~FlutterTraceScope() {
+    FlutterTrace::Record(name_, FlutterTrace::Phase::kEnd);
+  }
+
+  // Prevent copying.
+  FlutterTraceScope(FlutterTraceScope const &) = delete;
+  FlutterTraceScope &operator=(FlutterTraceScope const &) = delete;
+
+ private:
+  const char *name_;
+};
+
+#ifdef FLUTTER_TIZEN_TRACE_ENABLED
+#define FLUTTER_TRACE_CONCAT_INNER(a, b) a##b
+#define FLUTTER_TRACE_CONCAT(a, b) FLUTTER_TRACE_CONCAT_INNER(a, b)
+#define FLUTTER_TRACE_SCOPE(name) \
+  FlutterTraceScope FLUTTER_TRACE_CONCAT(flutter_trace_scope_, __LINE__)(name)
+#define FLUTTER_TRACE_INSTANT(name) \
+  FlutterTrace::Record(name, FlutterTrace::Phase::kInstant)
+#else
+#define FLUTTER_TRACE_SCOPE(name)
+#define FLUTTER_TRACE_INSTANT(name)
+#endif
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_TRACE_H_ */
@@ -0,0 +1,131 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_WATCHDOG_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_WATCHDOG_H_
+
+#include <Ecore.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Detects stalls of the platform thread before the platform watchdog kills
+// the app.
+//
+// A timer on the platform thread records a heartbeat, and a monitor thread
+// reports a stall when no heartbeat has been recorded for longer than the
+// threshold. The report names the activity that was running on the platform
+// thread, as marked by |ScopedActivity|. If no activity was marked, the
+// platform thread was most likely running Dart code, since the UI isolate
+// runs on the platform thread by default.
+//
+// When the platform thread is healthy, the cost is one timer callback per
+// heartbeat interval and a few atomic stores per marked activity.
+class FlutterWatchdog {
+ public:
+  struct StallReport {
+    // How long the platform thread has not responded.
+    std::chrono::milliseconds duration{0};
+    // The activity running on the platform thread, or empty if none.
+    std::string activity;
+    // How long the activity has been running.
+    std::chrono::milliseconds activity_duration{0};
+    // The native stack of the platform thread, if captured.
+    std::vector<std::string> native_stack;
+  };
+
+  // Called on the monitor thread when a stall is detected.
+  using StallCallback = std::function<void(const StallReport &report)>;
+
+  // Marks an activity running on the platform thread for the lifetime of
+  // this object.
+  //
+  // |name| must have static storage duration (e.g. a string literal).
+  // Activities can be nested, in which case the innermost one is reported.
+  class ScopedActivity {
+   public:
+    explicit ScopedActivity(const char *name);
+    ~ScopedActivity();
+
+    // Prevent copying.
+    ScopedActivity(ScopedActivity const &) = delete;
+    ScopedActivity &operator=(ScopedActivity const &) = delete;
+
+   private:
+    const char *previous_name_;
+    int64_t previous_start_time_;
+  };
+
+  // Creates a watchdog reporting stalls longer than |threshold_seconds|.
+  //
+  // If |dump_native_stack| is true, the native stack of the platform thread
+  // is captured on a stall by interrupting it with SIGUSR2. Other SIGUSR2
+  // signals are passed on to the handler installed before, if any. The
+  // signal handler is installed by the first |Start| and stays installed
+  // for the lifetime of the process, since a signal may still be pending
+  // after a capture times out.
+  explicit FlutterWatchdog(double threshold_seconds,
+                           bool dump_native_stack = false,
+                           StallCallback callback = nullptr);
+  virtual ~FlutterWatchdog();
+
+  // Prevent copying.
+  FlutterWatchdog(FlutterWatchdog const &) = delete;
+  FlutterWatchdog &operator=(FlutterWatchdog const &) = delete;
+
+  // Starts the heartbeat and the monitor thread.
+  //
+  // Must be called on the platform thread while the main loop is running.
+  bool Start();
+
+  // Stops the watchdog. Must be called on the platform thread.
+  void Stop();
+
+ private:
+  // Called on the platform thread to record a heartbeat.
+  static Eina_Bool OnHeartbeat(void *data);
+
+  // Checks for stalls until |Stop| is called.
+  void Monitor();
+
+  // Builds and emits a report of the current stall.
+  void ReportStall(std::chrono::milliseconds duration);
+
+  // Returns the native stack of the platform thread, or an empty list if it
+  // could not be captured.
+  std::vector<std::string> CaptureNativeStack();
+
+  // The stall threshold.
+  std::chrono::milliseconds threshold_;
+
+  // The interval between heartbeats and between checks.
+  std::chrono::milliseconds interval_;
+
+  // Whether to capture the native stack on a stall.
+  bool dump_native_stack_;
+
+  // Called when a stall is detected.
+  StallCallback callback_;
+
+  // The timer recording heartbeats.
+  Ecore_Timer *heartbeat_timer_ = nullptr;
+
+  // The monitor thread.
+  std::thread monitor_thread_;
+
+  // Guards |is_stopping_|.
+  std::mutex mutex_;
+  std::condition_variable condition_;
+
+  // Whether |Stop| has been called.
+  bool is_stopping_ = false;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_WATCHDOG_H_ */
@@ -0,0 +1,152 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_WORKER_POOL_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_WORKER_POOL_H_
+
+#include <flutter_tizen.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter_engine.h"
+#include "flutter_engine_arguments.h"
+
+// Runs jobs on headless worker engines in parallel.
+//
+// Each worker is a separate engine whose UI isolate runs on its own thread,
+// so jobs sent to different workers run on different cores. A job is an
+// opaque binary message sent to a worker over |channel|, and the result is
+// the reply of the worker.
+//
+// The Dart entrypoint of a worker must register a handler for |channel| and
+// then send an empty message on the same channel to tell that it is ready,
+// for example:
+//
+//   @pragma('vm:entry-point')
+//   void worker() {
+//     const channel = BasicMessageChannel<ByteData?>(
+//         'tizen/worker', BinaryCodec());
+//     channel.setMessageHandler((ByteData? job) async => process(job));
+//     channel.send(null);
+//   }
+//
+// Jobs are queued until a worker is ready and dispatched to the ready worker
+// with the fewest jobs in flight. All methods must be called on the platform
+// thread, and result callbacks are also invoked on the platform thread.
+class FlutterWorkerPool {
+ public:
+  // Called with the reply of a worker, or with nullptr if the job could not
+  // be run.
+  using ResultCallback = std::function<void(const uint8_t* result,
+                                            size_t result_size)>;
+
+  struct Stats {
+    // The number of jobs passed to |Submit|.
+    uint64_t submitted = 0;
+    // The number of jobs replied to by a worker.
+    uint64_t completed = 0;
+    // The number of jobs which could not be run.
+    uint64_t failed = 0;
+  };
+
+  explicit FlutterWorkerPool(const std::string& channel = "tizen/worker",
+                             size_t max_jobs_per_worker = 1);
+  virtual ~FlutterWorkerPool();
+
+  // Prevent copying.
+  FlutterWorkerPool(FlutterWorkerPool const&) = delete;
+  FlutterWorkerPool& operator=(FlutterWorkerPool const&) = delete;
+
+  // Creates and starts |count| workers running |dart_entrypoint| with
+  // |dart_entrypoint_args|.
+  //
+  // The workers share the already parsed engine |arguments|. Returns the
+  // number of workers started.
+  size_t Spawn(std::shared_ptr<const FlutterEngineArguments> arguments,
+               size_t count, const std::string& dart_entrypoint,
+               const std::vector<std::string>& dart_entrypoint_args = {});
+
+  // Queues a job and dispatches it as soon as a worker is available.
+  void Submit(std::vector<uint8_t> message, ResultCallback callback);
+
+  // Shuts down all workers. Queued jobs and jobs in flight are completed
+  // with nullptr.
+  void Shutdown();
+
+  // The number of workers started by |Spawn|.
+  size_t GetWorkerCount() const { return workers_.size(); }
+
+  // The number of jobs waiting for a worker.
+  size_t GetQueuedCount() const { return queue_.size(); }
+
+  // The engines of all workers.
+  std::vector<FlutterEngine*> GetEngines();
+
+  // The counters for the jobs handled so far.
+  const Stats& GetStats() const { return stats_; }
+
+ private:
+  struct Job {
+    std::vector<uint8_t> message;
+    ResultCallback callback;
+  };
+
+  struct Worker {
+    FlutterWorkerPool* pool = nullptr;
+    std::unique_ptr<FlutterEngine> engine;
+    // Whether the worker has registered its handler.
+    bool is_ready = false;
+    // The number of jobs sent to the worker and not replied to yet.
+    size_t jobs_in_flight = 0;
+  };
+
+  // A job sent to a worker and waiting for its reply.
+  struct PendingJob {
+    std::shared_ptr<Worker> worker;
+    ResultCallback callback;
+  };
+
+  // Sends queued jobs to available workers.
+  void Dispatch();
+
+  // Returns the ready worker with the fewest jobs in flight, or nullptr if
+  // all workers are busy.
+  std::shared_ptr<Worker> FindAvailableWorker();
+
+  // Called when a worker sends a message on |channel_|.
+  static void OnWorkerMessage(FlutterDesktopMessengerRef messenger,
+                              const FlutterDesktopMessage* message,
+                              void* user_data);
+
+  // Called when a worker replies to a job.
+  //
+  // |user_data| is the ID of the job, so that late replies to jobs which
+  // have already been completed can be ignored.
+  static void OnJobReply(const uint8_t* data, size_t size, void* user_data);
+
+  // The channel which jobs are sent over.
+  std::string channel_;
+
+  // The maximum number of jobs sent to a worker at once.
+  size_t max_jobs_per_worker_;
+
+  // The workers, shared with the replies in flight.
+  std::vector<std::shared_ptr<Worker>> workers_;
+
+  // The jobs waiting for a worker, in the order submitted.
+  std::deque<Job> queue_;
+
+  // The jobs sent to workers and waiting for their replies, keyed by ID.
+  std::map<uintptr_t, PendingJob> in_flight_;
+
+  Stats stats_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_INCLUDE_FLUTTER_WORKER_POOL_H_ */
@@ -0,0 +1,68 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "fake_dart_api.h"
+
+#include <utility>
+
+int FakeDartApi::initialize_count_ = 0;
+std::set<Dart_Port> FakeDartApi::open_ports_;
+std::vector<FakeExternalData> FakeDartApi::held_data_;
+
+bool FakePostCObject(Dart_Port port, Dart_CObject* message) {
+  if (FakeDartApi::open_ports_.count(port) == 0) {
+    return false;
+  }
+  if (message->type == Dart_CObject_kExternalTypedData) {
+    FakeExternalData data;
+    data.port = port;
+    data.data = message->value.as_external_typed_data.data;
+    data.length = message->value.as_external_typed_data.length;
+    data.peer = message->value.as_external_typed_data.peer;
+    data.callback = message->value.as_external_typed_data.callback;
+    FakeDartApi::held_data_.push_back(data);
+  }
+  return true;
+}
+
+Dart_PostCObject_Type Dart_PostCObject_DL = nullptr;
+
+intptr_t Dart_InitializeApiDL(void* data) {
+  if (!data) {
+    return -1;
+  }
+  Dart_PostCObject_DL = FakePostCObject;
+  FakeDartApi::initialize_count_++;
+  return 0;
+}
+
+void FakeDartApi::OpenPort(Dart_Port port) {
+  open_ports_.insert(port);
+}
+
+void FakeDartApi::ClosePort(Dart_Port port) {
+  open_ports_.erase(port);
+}
+
+size_t FakeDartApi::CollectGarbage(Dart_Port port) {
+  std::vector<FakeExternalData> collected;
+  std::vector<FakeExternalData> kept;
+  for (const FakeExternalData& data : held_data_) {
+    if (port == ILLEGAL_PORT || data.port == port) {
+      collected.push_back(data);
+    } else {
+      kept.push_back(data);
+    }
+  }
+  held_data_ = std::move(kept);
+  for (const FakeExternalData& data : collected) {
+    data.callback(nullptr, data.peer);
+  }
+  return collected.size();
+}
+
+void FakeDartApi::Reset() {
+  CollectGarbage();
+  open_ports_.clear();
+}
@@ -0,0 +1,64 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_DART_API_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_DART_API_H_
+
+#include <dart_api_dl.h>
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+// External typed data posted to a port, which the fake Dart side holds
+// until it is collected.
+struct FakeExternalData {
+  Dart_Port port = ILLEGAL_PORT;
+  uint8_t* data = nullptr;
+  intptr_t length = 0;
+  void* peer = nullptr;
+  Dart_HandleFinalizer callback = nullptr;
+};
+
+// Stands in for the Dart side of the ports which native code posts to.
+//
+// Only ports opened by |OpenPort| accept messages. Posting is not
+// thread-safe, unlike the real API.
+class FakeDartApi {
+ public:
+  static void OpenPort(Dart_Port port);
+
+  // Closes |port|. Data already posted to it stays held until collected.
+  static void ClosePort(Dart_Port port);
+
+  // The number of times |Dart_InitializeApiDL| has been called.
+  static int GetInitializeCount() { return initialize_count_; }
+
+  // The external typed data held by the Dart side, in the order posted.
+  static const std::vector<FakeExternalData>& GetHeldData() {
+    return held_data_;
+  }
+
+  // Finalizes the external typed data posted to |port|, or to any port if
+  // |port| is ILLEGAL_PORT, as if it had been garbage collected.
+  //
+  // Returns the number of finalized objects.
+  static size_t CollectGarbage(Dart_Port port = ILLEGAL_PORT);
+
+  // Closes all ports and collects all held data.
+  static void Reset();
+
+ private:
+  friend intptr_t Dart_InitializeApiDL(void* data);
+  friend bool FakePostCObject(Dart_Port port, Dart_CObject* message);
+
+  explicit FakeDartApi() {}
+  virtual ~FakeDartApi() {}
+
+  static int initialize_count_;
+  static std::set<Dart_Port> open_ports_;
+  static std::vector<FakeExternalData> held_data_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_DART_API_H_ */
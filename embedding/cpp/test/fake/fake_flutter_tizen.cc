@@ -0,0 +1,200 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "fake_flutter_tizen.h"
+
+int FakeFlutterTizen::live_engine_count_ = 0;
+int FakeFlutterTizen::created_engine_count_ = 0;
+bool FakeFlutterTizen::engine_create_fails_ = false;
+
+namespace {
+
+// Frees |messenger| once it has no engine and no references.
+void MaybeFreeMessenger(FlutterDesktopMessenger* messenger) {
+  if (!messenger->engine && messenger->ref_count == 0) {
+    delete messenger;
+  }
+}
+
+}  // namespace
+
+void FakeFlutterTizen::Reset() {
+  live_engine_count_ = 0;
+  created_engine_count_ = 0;
+  engine_create_fails_ = false;
+}
+
+bool FakeFlutterTizen::SendToCallback(FlutterDesktopMessengerRef messenger,
+                                      const std::string& channel,
+                                      const std::vector<uint8_t>& message) {
+  auto iter = messenger->callbacks.find(channel);
+  if (iter == messenger->callbacks.end()) {
+    return false;
+  }
+  FlutterDesktopMessage desktop_message = {};
+  desktop_message.struct_size = sizeof(desktop_message);
+  desktop_message.channel = channel.c_str();
+  desktop_message.message = message.data();
+  desktop_message.message_size = message.size();
+  auto [callback, user_data] = iter->second;
+  callback(messenger, &desktop_message, user_data);
+  return true;
+}
+
+FlutterDesktopEngineRef FlutterDesktopEngineCreate(
+    const FlutterDesktopEngineProperties& engine_properties) {
+  if (FakeFlutterTizen::engine_create_fails_) {
+    return nullptr;
+  }
+  auto* engine = new FlutterDesktopEngine();
+  if (engine_properties.entrypoint) {
+    engine->entrypoint = engine_properties.entrypoint;
+  }
+  engine->messenger = new FlutterDesktopMessenger();
+  engine->messenger->engine = engine;
+  FakeFlutterTizen::live_engine_count_++;
+  FakeFlutterTizen::created_engine_count_++;
+  return engine;
+}
+
+bool FlutterDesktopEngineRun(const FlutterDesktopEngineRef engine) {
+  if (engine->is_running) {
+    return false;
+  }
+  engine->is_running = true;
+  return true;
+}
+
+void FlutterDesktopEngineShutdown(FlutterDesktopEngineRef engine) {
+  FlutterDesktopMessenger* messenger = engine->messenger;
+  messenger->engine = nullptr;
+  messenger->callbacks.clear();
+  MaybeFreeMessenger(messenger);
+  delete engine;
+  FakeFlutterTizen::live_engine_count_--;
+}
+
+FlutterDesktopPluginRegistrarRef FlutterDesktopEngineGetPluginRegistrar(
+    FlutterDesktopEngineRef engine, const char* plugin_name) {
+  // The registrar is only passed back to the messenger API.
+  return reinterpret_cast<FlutterDesktopPluginRegistrarRef>(engine);
+}
+
+FlutterDesktopMessengerRef FlutterDesktopPluginRegistrarGetMessenger(
+    FlutterDesktopPluginRegistrarRef registrar) {
+  return reinterpret_cast<FlutterDesktopEngineRef>(registrar)->messenger;
+}
+
+FlutterDesktopMessengerRef FlutterDesktopEngineGetMessenger(
+    FlutterDesktopEngineRef engine) {
+  return engine->messenger;
+}
+
+void FlutterDesktopEngineNotifyAppControl(FlutterDesktopEngineRef engine,
+                                          void* app_control) {
+  engine->app_control_count++;
+}
+
+void FlutterDesktopEngineNotifyLocaleChange(FlutterDesktopEngineRef engine) {
+  engine->locale_change_count++;
+}
+
+void FlutterDesktopEngineNotifyLowMemoryWarning(
+    FlutterDesktopEngineRef engine) {
+  engine->low_memory_warning_count++;
+}
+
+void FlutterDesktopEngineNotifyAppIsResumed(FlutterDesktopEngineRef engine) {
+  engine->resumed_count++;
+}
+
+void FlutterDesktopEngineNotifyAppIsPaused(FlutterDesktopEngineRef engine) {
+  engine->paused_count++;
+}
+
+void FlutterDesktopEngineNotifyAppIsDetached(FlutterDesktopEngineRef engine) {
+  engine->detached_count++;
+}
+
+FlutterDesktopViewRef FlutterDesktopViewCreateFromNewWindow(
+    const FlutterDesktopWindowProperties& window_properties,
+    FlutterDesktopEngineRef engine) {
+  // Like the real engine, a view runs the engine itself, so the engine must
+  // not have been started.
+  if (engine->is_running || engine->has_view) {
+    return nullptr;
+  }
+  engine->is_running = true;
+  engine->has_view = true;
+  return reinterpret_cast<FlutterDesktopViewRef>(engine);
+}
+
+void FlutterDesktopViewDestroy(FlutterDesktopViewRef view) {
+  // The view owns the engine.
+  FlutterDesktopEngineShutdown(reinterpret_cast<FlutterDesktopEngineRef>(view));
+}
+
+bool FlutterDesktopMessengerSend(FlutterDesktopMessengerRef messenger,
+                                 const char* channel, const uint8_t* message,
+                                 const size_t message_size) {
+  return messenger->engine != nullptr;
+}
+
+bool FlutterDesktopMessengerSendWithReply(FlutterDesktopMessengerRef messenger,
+                                          const char* channel,
+                                          const uint8_t* message,
+                                          const size_t message_size,
+                                          const FlutterDesktopBinaryReply reply,
+                                          void* user_data) {
+  if (!messenger->engine) {
+    return false;
+  }
+  FakeSentMessage sent_message;
+  sent_message.channel = channel;
+  sent_message.message.assign(message, message + message_size);
+  sent_message.reply = reply;
+  sent_message.user_data = user_data;
+  messenger->sent_messages.push_back(std::move(sent_message));
+  return true;
+}
+
+void FlutterDesktopMessengerSendResponse(
+    FlutterDesktopMessengerRef messenger,
+    const FlutterDesktopMessageResponseHandle* handle, const uint8_t* data,
+    size_t data_length) {
+  messenger->responses.emplace_back(data, data + data_length);
+}
+
+void FlutterDesktopMessengerSetCallback(FlutterDesktopMessengerRef messenger,
+                                        const char* channel,
+                                        FlutterDesktopMessageCallback callback,
+                                        void* user_data) {
+  if (callback) {
+    messenger->callbacks[channel] = std::make_pair(callback, user_data);
+  } else {
+    messenger->callbacks.erase(channel);
+  }
+}
+
+FlutterDesktopMessengerRef FlutterDesktopMessengerAddRef(
+    FlutterDesktopMessengerRef messenger) {
+  messenger->ref_count++;
+  return messenger;
+}
+
+void FlutterDesktopMessengerRelease(FlutterDesktopMessengerRef messenger) {
+  messenger->ref_count--;
+  MaybeFreeMessenger(messenger);
+}
+
+bool FlutterDesktopMessengerIsAvailable(FlutterDesktopMessengerRef messenger) {
+  return messenger->engine != nullptr;
+}
+
+FlutterDesktopMessengerRef FlutterDesktopMessengerLock(
+    FlutterDesktopMessengerRef messenger) {
+  return messenger;
+}
+
+void FlutterDesktopMessengerUnlock(FlutterDesktopMessengerRef messenger) {}
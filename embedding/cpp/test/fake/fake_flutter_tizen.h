@@ -0,0 +1,105 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_FLUTTER_TIZEN_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_FLUTTER_TIZEN_H_
+
+#include <flutter_tizen.h>
+
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A message sent by |FlutterDesktopMessengerSendWithReply|, which the fake
+// engine keeps until a test replies to it.
+struct FakeSentMessage {
+  std::string channel;
+  std::vector<uint8_t> message;
+  FlutterDesktopBinaryReply reply = nullptr;
+  void* user_data = nullptr;
+};
+
+// The state of a messenger of the fake engine.
+//
+// A messenger is freed once its engine is shut down and all references
+// taken by |FlutterDesktopMessengerAddRef| are released.
+struct FlutterDesktopMessenger {
+  // The engine which this messenger belongs to, or nullptr once shut down.
+  FlutterDesktopEngine* engine = nullptr;
+
+  // The number of references taken by |FlutterDesktopMessengerAddRef|.
+  int ref_count = 0;
+
+  // The callbacks set by channel name.
+  std::map<std::string, std::pair<FlutterDesktopMessageCallback, void*>>
+      callbacks;
+
+  // The messages sent with a reply callback, in order, which have not been
+  // replied to yet.
+  std::deque<FakeSentMessage> sent_messages;
+
+  // The responses sent by |FlutterDesktopMessengerSendResponse|, in order.
+  std::vector<std::vector<uint8_t>> responses;
+};
+
+// The state of an engine created by the fake |FlutterDesktopEngineCreate|.
+struct FlutterDesktopEngine {
+  // The entrypoint passed on creation, or empty for the default one.
+  std::string entrypoint;
+
+  // Whether |FlutterDesktopEngineRun| has been called.
+  bool is_running = false;
+
+  // Whether a view has been created for this engine.
+  bool has_view = false;
+
+  // The messenger of this engine.
+  FlutterDesktopMessenger* messenger = nullptr;
+
+  // The number of notifications received by this engine, by kind.
+  int app_control_count = 0;
+  int locale_change_count = 0;
+  int low_memory_warning_count = 0;
+  int resumed_count = 0;
+  int paused_count = 0;
+  int detached_count = 0;
+};
+
+// Records the calls made to the fake engine API.
+class FakeFlutterTizen {
+ public:
+  // The number of engines which have been created and not shut down.
+  static int GetLiveEngineCount() { return live_engine_count_; }
+
+  // The number of engines created so far.
+  static int GetCreatedEngineCount() { return created_engine_count_; }
+
+  // Makes |FlutterDesktopEngineCreate| fail if |fail| is true.
+  static void SetEngineCreateFails(bool fail) { engine_create_fails_ = fail; }
+
+  // Resets all counters.
+  static void Reset();
+
+  // Delivers |message| on |channel| to the callback set on |messenger|, as
+  // if it was sent by the Dart side. Returns false if no callback is set.
+  static bool SendToCallback(FlutterDesktopMessengerRef messenger,
+                             const std::string& channel,
+                             const std::vector<uint8_t>& message);
+
+ private:
+  friend FlutterDesktopEngineRef FlutterDesktopEngineCreate(
+      const FlutterDesktopEngineProperties& engine_properties);
+  friend void FlutterDesktopEngineShutdown(FlutterDesktopEngineRef engine);
+
+  explicit FakeFlutterTizen() {}
+  virtual ~FakeFlutterTizen() {}
+
+  static int live_engine_count_;
+  static int created_engine_count_;
+  static bool engine_create_fails_;
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_FLUTTER_TIZEN_H_ */
@@ -0,0 +1,458 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Host stand-ins for the Tizen APIs used by the embedding.
+//
+// The app has an ID but no data or resource directory, so nothing is read
+// from or written to the app package.
+
+#include "fake_tizen.h"
+
+#include <Ecore.h>
+#include <app.h>
+#include <app_manager.h>
+#include <bundle.h>
+#include <dlog.h>
+#include <service_app.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct _Ecore_Timer {
+  Ecore_Task_Cb func;
+  const void* data;
+};
+
+struct app_control_s {
+  std::string operation;
+  std::string uri;
+  std::string mime;
+  // The extra data in the order added, and whether each is an array.
+  std::vector<std::pair<std::string, std::vector<std::string>>> extra_data;
+  std::map<std::string, bool> is_array;
+  bool is_reply_requested = false;
+};
+
+struct app_event_info {
+  app_event_low_memory_status_e low_memory_status;
+};
+
+namespace {
+
+constexpr char kAppId[] = "org.tizen.flutter_embedding_test";
+constexpr char kDefaultOperation[] =
+    "http://tizen.org/appcontrol/operation/default";
+
+// The timers which have been added and not deleted, in the order added.
+std::vector<Ecore_Timer*> g_timers;
+
+// The calls posted from any thread and not run yet, in the order posted.
+std::mutex g_async_calls_mutex;
+std::condition_variable g_async_calls_cv;
+std::vector<std::pair<Ecore_Cb, void*>> g_async_calls;
+
+// The callbacks of the app run by the fake main loop.
+struct AppCallbacks {
+  app_create_cb create = nullptr;
+  app_terminate_cb terminate = nullptr;
+  app_pause_cb pause = nullptr;
+  app_resume_cb resume = nullptr;
+  app_control_cb app_control = nullptr;
+  void* user_data = nullptr;
+  std::map<app_event_type_e, std::pair<app_event_cb, void*>> event_handlers;
+};
+
+AppCallbacks g_app;
+FakeAppMain::Script g_script;
+
+char* DuplicateOrNull(const std::string& value) {
+  return value.empty() ? nullptr : strdup(value.c_str());
+}
+
+int AddEventHandler(app_event_handler_h* handler, app_event_type_e event_type,
+                    app_event_cb callback, void* user_data) {
+  g_app.event_handlers[event_type] = std::make_pair(callback, user_data);
+  // The handler is never removed, so any non-null value will do.
+  *handler = reinterpret_cast<app_event_handler_h>(event_type + 1);
+  return APP_ERROR_NONE;
+}
+
+// Runs the app with |g_app| from creation to termination.
+int RunAppMain() {
+  if (!g_app.create(g_app.user_data)) {
+    g_app = AppCallbacks();
+    return APP_ERROR_INVALID_CONTEXT;
+  }
+  app_control_h launch_request = nullptr;
+  app_control_create(&launch_request);
+  app_control_set_operation(launch_request, kDefaultOperation);
+  FakeAppMain::SendAppControl(launch_request);
+  app_control_destroy(launch_request);
+  FakeAppMain::Resume();
+
+  FakeAppMain::Script script = std::move(g_script);
+  g_script = nullptr;
+  if (script) {
+    script();
+  }
+
+  FakeAppMain::Pause();
+  g_app.terminate(g_app.user_data);
+  g_app = AppCallbacks();
+  return APP_ERROR_NONE;
+}
+
+}  // namespace
+
+size_t FakeEcore::RunTimers() {
+  std::vector<Ecore_Timer*> timers = g_timers;
+  size_t fired = 0;
+  for (Ecore_Timer* timer : timers) {
+    // Skip timers deleted by an earlier callback.
+    if (std::find(g_timers.begin(), g_timers.end(), timer) == g_timers.end()) {
+      continue;
+    }
+    fired++;
+    if (!timer->func(const_cast<void*>(timer->data))) {
+      auto it = std::find(g_timers.begin(), g_timers.end(), timer);
+      if (it != g_timers.end()) {
+        g_timers.erase(it);
+        delete timer;
+      }
+    }
+  }
+  return fired;
+}
+
+size_t FakeEcore::GetTimerCount() {
+  return g_timers.size();
+}
+
+void FakeEcore::Reset() {
+  for (Ecore_Timer* timer : g_timers) {
+    delete timer;
+  }
+  g_timers.clear();
+}
+
+size_t FakeEcore::RunAsyncCalls(size_t min_count) {
+  std::vector<std::pair<Ecore_Cb, void*>> calls;
+  {
+    std::unique_lock<std::mutex> lock(g_async_calls_mutex);
+    g_async_calls_cv.wait_for(lock, std::chrono::seconds(10), [min_count]() {
+      return g_async_calls.size() >= min_count;
+    });
+    calls.swap(g_async_calls);
+  }
+  for (auto& [callback, data] : calls) {
+    callback(data);
+  }
+  return calls.size();
+}
+
+void FakeAppMain::SetScript(Script script) {
+  g_script = std::move(script);
+}
+
+void FakeAppMain::Resume() {
+  if (g_app.resume) {
+    g_app.resume(g_app.user_data);
+  }
+}
+
+void FakeAppMain::Pause() {
+  if (g_app.pause) {
+    g_app.pause(g_app.user_data);
+  }
+}
+
+void FakeAppMain::SendAppControl(app_control_h app_control) {
+  g_app.app_control(app_control, g_app.user_data);
+}
+
+void FakeAppMain::SendEvent(app_event_type_e type,
+                            app_event_low_memory_status_e low_memory_status) {
+  auto it = g_app.event_handlers.find(type);
+  if (it == g_app.event_handlers.end()) {
+    return;
+  }
+  app_event_info event_info = {low_memory_status};
+  it->second.first(&event_info, it->second.second);
+}
+
+void FakeAppMain::SetReplyRequested(app_control_h app_control,
+                                    bool requested) {
+  app_control->is_reply_requested = requested;
+}
+
+int ui_app_main(int argc, char** argv, ui_app_lifecycle_callback_s* callback,
+                void* user_data) {
+  g_app.create = callback->create;
+  g_app.terminate = callback->terminate;
+  g_app.pause = callback->pause;
+  g_app.resume = callback->resume;
+  g_app.app_control = callback->app_control;
+  g_app.user_data = user_data;
+  return RunAppMain();
+}
+
+int ui_app_add_event_handler(app_event_handler_h* handler,
+                             app_event_type_e event_type,
+                             app_event_cb callback, void* user_data) {
+  return AddEventHandler(handler, event_type, callback, user_data);
+}
+
+void ui_app_exit(void) {}
+
+int service_app_main(int argc, char** argv,
+                     service_app_lifecycle_callback_s* callback,
+                     void* user_data) {
+  g_app.create = callback->create;
+  g_app.terminate = callback->terminate;
+  g_app.app_control = callback->app_control;
+  g_app.user_data = user_data;
+  return RunAppMain();
+}
+
+int service_app_add_event_handler(app_event_handler_h* handler,
+                                  app_event_type_e event_type,
+                                  app_event_cb callback, void* user_data) {
+  return AddEventHandler(handler, event_type, callback, user_data);
+}
+
+void service_app_exit(void) {}
+
+int app_event_get_low_memory_status(app_event_info_h event_info,
+                                    app_event_low_memory_status_e* status) {
+  *status = event_info->low_memory_status;
+  return APP_ERROR_NONE;
+}
+
+int app_get_id(char** id) {
+  *id = strdup(kAppId);
+  return APP_ERROR_NONE;
+}
+
+int app_get_version(char** version) {
+  *version = strdup("1.0.0");
+  return APP_ERROR_NONE;
+}
+
+char* app_get_data_path(void) {
+  return nullptr;
+}
+
+char* app_get_resource_path(void) {
+  return nullptr;
+}
+
+// The app has no metadata.
+int app_manager_get_app_info(const char* app_id, app_info_h* app_info) {
+  *app_info = nullptr;
+  return APP_MANAGER_ERROR_NONE;
+}
+
+int app_info_foreach_metadata(app_info_h app_info,
+                              app_info_metadata_cb callback, void* user_data) {
+  return APP_MANAGER_ERROR_NONE;
+}
+
+int app_info_destroy(app_info_h app_info) {
+  return APP_MANAGER_ERROR_NONE;
+}
+
+int dlog_vprint(log_priority prio, const char* tag, const char* fmt,
+                va_list ap) {
+  fprintf(stderr, "[%s] ", tag);
+  int result = vfprintf(stderr, fmt, ap);
+  fputc('\n', stderr);
+  return result;
+}
+
+int dlog_print(log_priority prio, const char* tag, const char* fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  int result = dlog_vprint(prio, tag, fmt, ap);
+  va_end(ap);
+  return result;
+}
+
+// Timers only fire when a test calls |FakeEcore::RunTimers|, since the tests
+// have no main loop.
+Ecore_Timer* ecore_timer_add(double in, Ecore_Task_Cb func, const void* data) {
+  auto* timer = new Ecore_Timer{func, data};
+  g_timers.push_back(timer);
+  return timer;
+}
+
+void* ecore_timer_del(Ecore_Timer* timer) {
+  auto it = std::find(g_timers.begin(), g_timers.end(), timer);
+  if (it == g_timers.end()) {
+    return nullptr;
+  }
+  void* data = const_cast<void*>(timer->data);
+  g_timers.erase(it);
+  delete timer;
+  return data;
+}
+
+// Idlers never fire.
+Ecore_Idler* ecore_idler_add(Ecore_Task_Cb func, const void* data) {
+  return reinterpret_cast<Ecore_Idler*>(malloc(1));
+}
+
+void* ecore_idler_del(Ecore_Idler* idler) {
+  free(idler);
+  return nullptr;
+}
+
+void ecore_main_loop_thread_safe_call_async(Ecore_Cb callback, void* data) {
+  std::lock_guard<std::mutex> lock(g_async_calls_mutex);
+  g_async_calls.emplace_back(callback, data);
+  g_async_calls_cv.notify_all();
+}
+
+// There is no launch bundle, so the launch time is unknown.
+bundle* bundle_import_from_argv(int argc, char** argv) {
+  return nullptr;
+}
+
+int bundle_get_str(bundle* b, const char* key, char** str) {
+  return BUNDLE_ERROR_KEY_NOT_AVAILABLE;
+}
+
+int bundle_free(bundle* b) {
+  return BUNDLE_ERROR_NONE;
+}
+
+int app_control_create(app_control_h* app_control) {
+  *app_control = new app_control_s();
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_destroy(app_control_h app_control) {
+  delete app_control;
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_clone(app_control_h* clone, app_control_h app_control) {
+  *clone = new app_control_s(*app_control);
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_set_operation(app_control_h app_control,
+                              const char* operation) {
+  app_control->operation = operation ? operation : "";
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_get_operation(app_control_h app_control, char** operation) {
+  *operation = DuplicateOrNull(app_control->operation);
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_set_uri(app_control_h app_control, const char* uri) {
+  app_control->uri = uri ? uri : "";
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_get_uri(app_control_h app_control, char** uri) {
+  *uri = DuplicateOrNull(app_control->uri);
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_set_mime(app_control_h app_control, const char* mime) {
+  app_control->mime = mime ? mime : "";
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_get_mime(app_control_h app_control, char** mime) {
+  *mime = DuplicateOrNull(app_control->mime);
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_add_extra_data(app_control_h app_control, const char* key,
+                               const char* value) {
+  const char* values[] = {value};
+  app_control_add_extra_data_array(app_control, key, values, 1);
+  app_control->is_array[key] = false;
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_add_extra_data_array(app_control_h app_control,
+                                     const char* key, const char* value[],
+                                     int length) {
+  std::vector<std::string> values(value, value + length);
+  auto& extra_data = app_control->extra_data;
+  auto it = std::find_if(extra_data.begin(), extra_data.end(),
+                         [key](const auto& entry) {
+                           return entry.first == key;
+                         });
+  if (it != extra_data.end()) {
+    it->second = std::move(values);
+  } else {
+    extra_data.emplace_back(key, std::move(values));
+  }
+  app_control->is_array[key] = true;
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_get_extra_data(app_control_h app_control, const char* key,
+                               char** value) {
+  for (const auto& [name, values] : app_control->extra_data) {
+    if (name == key && !app_control->is_array[key]) {
+      *value = strdup(values[0].c_str());
+      return APP_CONTROL_ERROR_NONE;
+    }
+  }
+  return APP_CONTROL_ERROR_INVALID_PARAMETER;
+}
+
+int app_control_get_extra_data_array(app_control_h app_control,
+                                     const char* key, char*** value,
+                                     int* length) {
+  for (const auto& [name, values] : app_control->extra_data) {
+    if (name == key && app_control->is_array[key]) {
+      *length = static_cast<int>(values.size());
+      *value = static_cast<char**>(malloc(sizeof(char*) * values.size()));
+      for (size_t i = 0; i < values.size(); i++) {
+        (*value)[i] = strdup(values[i].c_str());
+      }
+      return APP_CONTROL_ERROR_NONE;
+    }
+  }
+  return APP_CONTROL_ERROR_INVALID_PARAMETER;
+}
+
+int app_control_is_extra_data_array(app_control_h app_control,
+                                    const char* key, bool* array) {
+  *array = app_control->is_array[key];
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_foreach_extra_data(app_control_h app_control,
+                                   app_control_extra_data_cb callback,
+                                   void* user_data) {
+  for (const auto& entry : app_control->extra_data) {
+    if (!callback(app_control, entry.first.c_str(), user_data)) {
+      break;
+    }
+  }
+  return APP_CONTROL_ERROR_NONE;
+}
+
+int app_control_is_reply_requested(app_control_h app_control,
+                                   bool* requested) {
+  *requested = app_control->is_reply_requested;
+  return APP_CONTROL_ERROR_NONE;
+}
@@ -0,0 +1,78 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_TIZEN_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_TIZEN_H_
+
+#include <app_common.h>
+#include <app_control.h>
+
+#include <cstddef>
+#include <functional>
+
+// Controls the timers and async calls of the fake Ecore main loop.
+//
+// The tests have no main loop, so timers only fire when |RunTimers| is
+// called, and calls posted by |ecore_main_loop_thread_safe_call_async| only
+// run when |RunAsyncCalls| is called.
+class FakeEcore {
+ public:
+  // Fires every timer once, in the order they were added. Timers added
+  // meanwhile do not fire until the next call.
+  //
+  // Returns the number of timers fired.
+  static size_t RunTimers();
+
+  // The number of timers which have been added and not deleted.
+  static size_t GetTimerCount();
+
+  // Deletes all timers without firing them.
+  static void Reset();
+
+  // Waits until at least |min_count| calls have been posted by
+  // |ecore_main_loop_thread_safe_call_async|, or for up to 10 seconds, and
+  // runs all posted calls on the calling thread in the order posted.
+  //
+  // Returns the number of calls run.
+  static size_t RunAsyncCalls(size_t min_count = 0);
+
+ private:
+  explicit FakeEcore() {}
+  virtual ~FakeEcore() {}
+};
+
+// Drives an app run by the fake |ui_app_main| or |service_app_main|.
+//
+// The main loop creates the app, delivers a launch app control, resumes a
+// UI app, and then runs the script set by |SetScript|. The app is paused
+// (if a UI app) and terminated once the script returns. The methods which
+// deliver events must be called from the script.
+class FakeAppMain {
+ public:
+  using Script = std::function<void()>;
+
+  // Sets the script run by the next main loop.
+  static void SetScript(Script script);
+
+  static void Resume();
+  static void Pause();
+  static void SendAppControl(app_control_h app_control);
+
+  // Delivers a system event to the handler registered for |type|, if any.
+  //
+  // |low_memory_status| is only used for |APP_EVENT_LOW_MEMORY|.
+  static void SendEvent(app_event_type_e type,
+                        app_event_low_memory_status_e low_memory_status =
+                            APP_EVENT_LOW_MEMORY_SOFT_WARNING);
+
+  // Makes |app_control| request a reply from the app, as
+  // |app_control_send_launch_request| does with a reply callback.
+  static void SetReplyRequested(app_control_h app_control, bool requested);
+
+ private:
+  explicit FakeAppMain() {}
+  virtual ~FakeAppMain() {}
+};
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_FAKE_TIZEN_H_ */
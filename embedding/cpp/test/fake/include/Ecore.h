@@ -0,0 +1,28 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the parts of Ecore used by the embedding.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_ECORE_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_ECORE_H_
+
+typedef unsigned char Eina_Bool;
+
+#define EINA_TRUE ((Eina_Bool)1)
+#define EINA_FALSE ((Eina_Bool)0)
+#define ECORE_CALLBACK_CANCEL EINA_FALSE
+#define ECORE_CALLBACK_RENEW EINA_TRUE
+
+typedef struct _Ecore_Timer Ecore_Timer;
+typedef struct _Ecore_Idler Ecore_Idler;
+typedef Eina_Bool (*Ecore_Task_Cb)(void* data);
+typedef void (*Ecore_Cb)(void* data);
+
+Ecore_Timer* ecore_timer_add(double in, Ecore_Task_Cb func, const void* data);
+void* ecore_timer_del(Ecore_Timer* timer);
+Ecore_Idler* ecore_idler_add(Ecore_Task_Cb func, const void* data);
+void* ecore_idler_del(Ecore_Idler* idler);
+void ecore_main_loop_thread_safe_call_async(Ecore_Cb callback, void* data);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_ECORE_H_ */
@@ -0,0 +1,48 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the app common API.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_COMMON_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_COMMON_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct app_event_info* app_event_info_h;
+typedef struct app_event_handler* app_event_handler_h;
+
+typedef enum {
+  APP_EVENT_LOW_MEMORY,
+  APP_EVENT_LOW_BATTERY,
+  APP_EVENT_LANGUAGE_CHANGED,
+  APP_EVENT_DEVICE_ORIENTATION_CHANGED,
+  APP_EVENT_REGION_FORMAT_CHANGED,
+  APP_EVENT_SUSPENDED_STATE_CHANGED,
+} app_event_type_e;
+
+typedef enum {
+  APP_EVENT_LOW_MEMORY_NORMAL = 0x01,
+  APP_EVENT_LOW_MEMORY_SOFT_WARNING = 0x02,
+  APP_EVENT_LOW_MEMORY_HARD_WARNING = 0x04,
+} app_event_low_memory_status_e;
+
+typedef enum {
+  APP_ERROR_NONE = 0,
+  APP_ERROR_INVALID_PARAMETER = -22,
+  APP_ERROR_INVALID_CONTEXT = -0x01100000 | 0x01,
+} app_error_e;
+
+typedef void (*app_event_cb)(app_event_info_h event_info, void* user_data);
+
+int app_event_get_low_memory_status(app_event_info_h event_info,
+                                    app_event_low_memory_status_e* status);
+int app_get_id(char** id);
+int app_get_version(char** version);
+char* app_get_data_path(void);
+char* app_get_resource_path(void);
+char* app_get_shared_resource_path(void);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_COMMON_H_ */
@@ -0,0 +1,48 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the app control API.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_CONTROL_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_CONTROL_H_
+
+typedef struct app_control_s* app_control_h;
+
+typedef enum {
+  APP_CONTROL_ERROR_NONE = 0,
+  APP_CONTROL_ERROR_INVALID_PARAMETER = -22,
+} app_control_error_e;
+
+typedef bool (*app_control_extra_data_cb)(app_control_h app_control,
+                                          const char* key, void* user_data);
+
+int app_control_create(app_control_h* app_control);
+int app_control_destroy(app_control_h app_control);
+int app_control_clone(app_control_h* clone, app_control_h app_control);
+int app_control_set_operation(app_control_h app_control,
+                              const char* operation);
+int app_control_get_operation(app_control_h app_control, char** operation);
+int app_control_set_uri(app_control_h app_control, const char* uri);
+int app_control_get_uri(app_control_h app_control, char** uri);
+int app_control_set_mime(app_control_h app_control, const char* mime);
+int app_control_get_mime(app_control_h app_control, char** mime);
+int app_control_add_extra_data(app_control_h app_control, const char* key,
+                               const char* value);
+int app_control_add_extra_data_array(app_control_h app_control,
+                                     const char* key, const char* value[],
+                                     int length);
+int app_control_get_extra_data(app_control_h app_control, const char* key,
+                               char** value);
+int app_control_get_extra_data_array(app_control_h app_control,
+                                     const char* key, char*** value,
+                                     int* length);
+int app_control_is_extra_data_array(app_control_h app_control,
+                                    const char* key, bool* array);
+int app_control_foreach_extra_data(app_control_h app_control,
+                                   app_control_extra_data_cb callback,
+                                   void* user_data);
+int app_control_is_reply_requested(app_control_h app_control,
+                                   bool* requested);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_CONTROL_H_ */
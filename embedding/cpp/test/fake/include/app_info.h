@@ -0,0 +1,20 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the app info API.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_INFO_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_INFO_H_
+
+typedef struct app_info_s* app_info_h;
+
+typedef bool (*app_info_metadata_cb)(const char* metadata_key,
+                                     const char* metadata_value,
+                                     void* user_data);
+
+int app_info_foreach_metadata(app_info_h app_info,
+                              app_info_metadata_cb callback, void* user_data);
+int app_info_destroy(app_info_h app_info);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_INFO_H_ */
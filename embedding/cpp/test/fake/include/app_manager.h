@@ -0,0 +1,19 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the app manager API.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_MANAGER_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_MANAGER_H_
+
+#include <app_info.h>
+
+typedef enum {
+  APP_MANAGER_ERROR_NONE = 0,
+  APP_MANAGER_ERROR_NO_SUCH_APP = -0x01110000 | 0x01,
+} app_manager_error_e;
+
+int app_manager_get_app_info(const char* app_id, app_info_h* app_info);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_APP_MANAGER_H_ */
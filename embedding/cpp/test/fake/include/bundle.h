@@ -0,0 +1,21 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the bundle API.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_BUNDLE_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_BUNDLE_H_
+
+typedef struct _bundle_t bundle;
+
+typedef enum {
+  BUNDLE_ERROR_NONE = 0,
+  BUNDLE_ERROR_KEY_NOT_AVAILABLE = -126,
+} bundle_error_e;
+
+bundle* bundle_import_from_argv(int argc, char** argv);
+int bundle_get_str(bundle* b, const char* key, char** str);
+int bundle_free(bundle* b);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_BUNDLE_H_ */
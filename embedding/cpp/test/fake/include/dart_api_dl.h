@@ -0,0 +1,57 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the parts of the dynamically linked Dart API used by
+// the embedding.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_DART_API_DL_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_DART_API_DL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef int64_t Dart_Port;
+
+#define ILLEGAL_PORT ((Dart_Port)0)
+
+typedef void (*Dart_HandleFinalizer)(void* isolate_callback_data, void* peer);
+
+typedef enum {
+  Dart_TypedData_kByteData = 0,
+  Dart_TypedData_kInt8,
+  Dart_TypedData_kUint8,
+} Dart_TypedData_Type;
+
+typedef enum {
+  Dart_CObject_kNull = 0,
+  Dart_CObject_kBool,
+  Dart_CObject_kInt32,
+  Dart_CObject_kInt64,
+  Dart_CObject_kExternalTypedData,
+} Dart_CObject_Type;
+
+typedef struct _Dart_CObject {
+  Dart_CObject_Type type;
+  union {
+    bool as_bool;
+    int32_t as_int32;
+    int64_t as_int64;
+    struct {
+      Dart_TypedData_Type type;
+      intptr_t length;
+      uint8_t* data;
+      void* peer;
+      Dart_HandleFinalizer callback;
+    } as_external_typed_data;
+  } value;
+} Dart_CObject;
+
+intptr_t Dart_InitializeApiDL(void* data);
+
+typedef bool (*Dart_PostCObject_Type)(Dart_Port port_id,
+                                      Dart_CObject* message);
+
+extern Dart_PostCObject_Type Dart_PostCObject_DL;
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_DART_API_DL_H_ */
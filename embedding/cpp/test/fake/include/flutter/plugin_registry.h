@@ -0,0 +1,31 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the plugin registry of the C++ client wrapper.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_PLUGIN_REGISTRY_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_PLUGIN_REGISTRY_H_
+
+#include <flutter_plugin_registrar.h>
+
+#include <string>
+
+namespace flutter {
+
+class PluginRegistry {
+ public:
+  PluginRegistry() = default;
+  virtual ~PluginRegistry() = default;
+
+  // Prevent copying.
+  PluginRegistry(PluginRegistry const&) = delete;
+  PluginRegistry& operator=(PluginRegistry const&) = delete;
+
+  virtual FlutterDesktopPluginRegistrarRef GetRegistrarForPlugin(
+      const std::string& plugin_name) = 0;
+};
+
+}  // namespace flutter
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_PLUGIN_REGISTRY_H_ */
@@ -0,0 +1,66 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the messenger API of the engine.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_MESSENGER_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_MESSENGER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+typedef struct FlutterDesktopMessenger* FlutterDesktopMessengerRef;
+
+typedef struct _FlutterPlatformMessageResponseHandle
+    FlutterDesktopMessageResponseHandle;
+
+typedef void (*FlutterDesktopBinaryReply)(const uint8_t* data,
+                                          size_t data_size, void* user_data);
+
+typedef struct {
+  size_t struct_size;
+  const char* channel;
+  const uint8_t* message;
+  size_t message_size;
+  const FlutterDesktopMessageResponseHandle* response_handle;
+} FlutterDesktopMessage;
+
+typedef void (*FlutterDesktopMessageCallback)(
+    FlutterDesktopMessengerRef messenger, const FlutterDesktopMessage* message,
+    void* user_data);
+
+bool FlutterDesktopMessengerSend(FlutterDesktopMessengerRef messenger,
+                                 const char* channel, const uint8_t* message,
+                                 const size_t message_size);
+
+bool FlutterDesktopMessengerSendWithReply(FlutterDesktopMessengerRef messenger,
+                                          const char* channel,
+                                          const uint8_t* message,
+                                          const size_t message_size,
+                                          const FlutterDesktopBinaryReply reply,
+                                          void* user_data);
+
+void FlutterDesktopMessengerSendResponse(
+    FlutterDesktopMessengerRef messenger,
+    const FlutterDesktopMessageResponseHandle* handle, const uint8_t* data,
+    size_t data_length);
+
+void FlutterDesktopMessengerSetCallback(FlutterDesktopMessengerRef messenger,
+                                        const char* channel,
+                                        FlutterDesktopMessageCallback callback,
+                                        void* user_data);
+
+FlutterDesktopMessengerRef FlutterDesktopMessengerAddRef(
+    FlutterDesktopMessengerRef messenger);
+
+void FlutterDesktopMessengerRelease(FlutterDesktopMessengerRef messenger);
+
+bool FlutterDesktopMessengerIsAvailable(FlutterDesktopMessengerRef messenger);
+
+FlutterDesktopMessengerRef FlutterDesktopMessengerLock(
+    FlutterDesktopMessengerRef messenger);
+
+void FlutterDesktopMessengerUnlock(FlutterDesktopMessengerRef messenger);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_MESSENGER_H_ */
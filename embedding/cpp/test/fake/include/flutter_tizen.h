@@ -0,0 +1,93 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the public API of the engine.
+//
+// The engine is replaced by the recorder in fake_flutter_tizen.cc, so the
+// embedding can be built and tested on a Linux host.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_TIZEN_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_TIZEN_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flutter_messenger.h"
+#include "flutter_plugin_registrar.h"
+
+typedef struct FlutterDesktopEngine* FlutterDesktopEngineRef;
+typedef struct FlutterDesktopView* FlutterDesktopViewRef;
+
+typedef enum {
+  kEGL,
+  kVulkan,
+} FlutterDesktopRendererType;
+
+enum class FlutterDesktopUIThreadPolicy {
+  kDefault,
+  kRunOnPlatformThread,
+  kRunOnSeparateThread,
+};
+
+typedef struct {
+  int32_t x;
+  int32_t y;
+  int32_t width;
+  int32_t height;
+  bool transparent;
+  bool focusable;
+  bool top_level;
+  FlutterDesktopRendererType renderer_type;
+  double user_pixel_ratio;
+  void* window_handle;
+  bool pointing_device_support;
+  bool floating_menu_support;
+} FlutterDesktopWindowProperties;
+
+typedef struct {
+  const char* assets_path;
+  const char* icu_data_path;
+  const char* aot_library_path;
+  const char** switches;
+  size_t switches_count;
+  const char* entrypoint;
+  int dart_entrypoint_argc;
+  const char** dart_entrypoint_argv;
+  FlutterDesktopUIThreadPolicy ui_thread_policy;
+} FlutterDesktopEngineProperties;
+
+FlutterDesktopEngineRef FlutterDesktopEngineCreate(
+    const FlutterDesktopEngineProperties& engine_properties);
+
+bool FlutterDesktopEngineRun(const FlutterDesktopEngineRef engine);
+
+void FlutterDesktopEngineShutdown(FlutterDesktopEngineRef engine);
+
+FlutterDesktopPluginRegistrarRef FlutterDesktopEngineGetPluginRegistrar(
+    FlutterDesktopEngineRef engine, const char* plugin_name);
+
+FlutterDesktopMessengerRef FlutterDesktopEngineGetMessenger(
+    FlutterDesktopEngineRef engine);
+
+void FlutterDesktopEngineNotifyAppControl(FlutterDesktopEngineRef engine,
+                                          void* app_control);
+
+void FlutterDesktopEngineNotifyLocaleChange(FlutterDesktopEngineRef engine);
+
+void FlutterDesktopEngineNotifyLowMemoryWarning(
+    FlutterDesktopEngineRef engine);
+
+void FlutterDesktopEngineNotifyAppIsResumed(FlutterDesktopEngineRef engine);
+
+void FlutterDesktopEngineNotifyAppIsPaused(FlutterDesktopEngineRef engine);
+
+void FlutterDesktopEngineNotifyAppIsDetached(FlutterDesktopEngineRef engine);
+
+FlutterDesktopViewRef FlutterDesktopViewCreateFromNewWindow(
+    const FlutterDesktopWindowProperties& window_properties,
+    FlutterDesktopEngineRef engine);
+
+void FlutterDesktopViewDestroy(FlutterDesktopViewRef view);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_FLUTTER_TIZEN_H_ */
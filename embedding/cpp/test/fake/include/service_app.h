@@ -0,0 +1,32 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host stand-in for the service app API.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_SERVICE_APP_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_SERVICE_APP_H_
+
+#include <app_common.h>
+#include <app_control.h>
+
+typedef bool (*service_app_create_cb)(void* user_data);
+typedef void (*service_app_terminate_cb)(void* user_data);
+typedef void (*service_app_control_cb)(app_control_h app_control,
+                                       void* user_data);
+
+typedef struct {
+  service_app_create_cb create;
+  service_app_terminate_cb terminate;
+  service_app_control_cb app_control;
+} service_app_lifecycle_callback_s;
+
+int service_app_main(int argc, char** argv,
+                     service_app_lifecycle_callback_s* callback,
+                     void* user_data);
+int service_app_add_event_handler(app_event_handler_h* handler,
+                                  app_event_type_e event_type,
+                                  app_event_cb callback, void* user_data);
+void service_app_exit(void);
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_FAKE_INCLUDE_SERVICE_APP_H_ */
@@ -0,0 +1,366 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_app_control_coalescer.h"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fake/fake_flutter_tizen.h"
+#include "fake/fake_tizen.h"
+#include "testing.h"
+
+namespace {
+
+constexpr char kChannel[] = "tizen/app_control_ack";
+
+constexpr char kViewOperation[] = "http://tizen.org/appcontrol/operation/view";
+
+constexpr double kWindowSeconds = 0.1;
+
+// Deletes the timers left by a test once everything else is destroyed.
+class EcoreScope {
+ public:
+  EcoreScope() { FakeEcore::Reset(); }
+  ~EcoreScope() { FakeEcore::Reset(); }
+};
+
+// An app control of the view operation, destroyed with this object.
+class TestAppControl {
+ public:
+  explicit TestAppControl(const std::string& uri) {
+    app_control_create(&app_control_);
+    app_control_set_operation(app_control_, kViewOperation);
+    app_control_set_uri(app_control_, uri.c_str());
+  }
+
+  ~TestAppControl() { app_control_destroy(app_control_); }
+
+  // Prevent copying.
+  TestAppControl(TestAppControl const&) = delete;
+  TestAppControl& operator=(TestAppControl const&) = delete;
+
+  app_control_h get() { return app_control_; }
+
+ private:
+  app_control_h app_control_ = nullptr;
+};
+
+// Records the URIs of the delivered app controls.
+class Recorder {
+ public:
+  FlutterAppControlCoalescer::DeliverCallback GetCallback() {
+    return [this](app_control_h app_control) {
+      char* uri = nullptr;
+      app_control_get_uri(app_control, &uri);
+      uris.push_back(uri ? uri : "");
+      free(uri);
+    };
+  }
+
+  std::vector<std::string> uris;
+};
+
+// Adds a view app control of |uri| to |coalescer|.
+void Add(FlutterAppControlCoalescer& coalescer, const std::string& uri,
+         bool is_reply_requested = false) {
+  TestAppControl app_control(uri);
+  FakeAppMain::SetReplyRequested(app_control.get(), is_reply_requested);
+  coalescer.Add(app_control.get());
+}
+
+// An engine of the fake engine API, shut down when destroyed.
+class TestEngine {
+ public:
+  TestEngine() {
+    FlutterDesktopEngineProperties properties = {};
+    engine_ = FlutterDesktopEngineCreate(properties);
+  }
+
+  ~TestEngine() { FlutterDesktopEngineShutdown(engine_); }
+
+  FlutterDesktopMessengerRef GetMessenger() {
+    return FlutterDesktopEngineGetMessenger(engine_);
+  }
+
+ private:
+  FlutterDesktopEngineRef engine_ = nullptr;
+};
+
+// Sends the message of |enableAppControlBackPressure|.
+bool EnableBackPressure(FlutterDesktopMessengerRef messenger) {
+  return FakeFlutterTizen::SendToCallback(messenger, kChannel, {});
+}
+
+// Replies to the oldest ack request, as the Dart side does once it has
+// handled the app controls delivered before it.
+bool ReplyToAck(FlutterDesktopMessengerRef messenger) {
+  if (messenger->sent_messages.empty()) {
+    return false;
+  }
+  FakeSentMessage sent_message = messenger->sent_messages.front();
+  messenger->sent_messages.pop_front();
+  if (sent_message.channel != kChannel) {
+    return false;
+  }
+  sent_message.reply(nullptr, 0, sent_message.user_data);
+  return true;
+}
+
+}  // namespace
+
+TEST(WindowStartsAndEndsWithBurst) {
+  EcoreScope scope;
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(),
+                                       kWindowSeconds);
+  Add(coalescer, "a");
+  EXPECT_EQ(1u, recorder.uris.size());
+  EXPECT_EQ(1u, FakeEcore::GetTimerCount());
+
+  Add(coalescer, "b");
+  EXPECT_EQ(1u, recorder.uris.size());
+  EXPECT_EQ(1u, FakeEcore::RunTimers());
+  EXPECT_EQ(2u, recorder.uris.size());
+  // The window is renewed since the burst may go on.
+  EXPECT_EQ(1u, FakeEcore::GetTimerCount());
+
+  // A window without app controls ends the burst.
+  FakeEcore::RunTimers();
+  EXPECT_EQ(0u, FakeEcore::GetTimerCount());
+  Add(coalescer, "c");
+  EXPECT_EQ(3u, recorder.uris.size());
+  EXPECT_EQ(1u, FakeEcore::GetTimerCount());
+  EXPECT_EQ(3u, coalescer.GetStats().received);
+  EXPECT_EQ(3u, coalescer.GetStats().delivered);
+}
+
+TEST(DuplicatesAreMergedByKey) {
+  EcoreScope scope;
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(),
+                                       kWindowSeconds);
+  Add(coalescer, "first");
+
+  std::vector<std::unique_ptr<TestAppControl>> app_controls;
+  auto create = [&app_controls]() {
+    app_controls.push_back(std::make_unique<TestAppControl>("uri"));
+    return app_controls.back()->get();
+  };
+  app_control_h base = create();
+  app_control_add_extra_data(base, "x", "1");
+  app_control_add_extra_data(base, "y", "2");
+  // The same extra data added in another order.
+  app_control_h same = create();
+  app_control_add_extra_data(same, "y", "2");
+  app_control_add_extra_data(same, "x", "1");
+  app_control_h other_operation = create();
+  app_control_set_operation(other_operation, "other");
+  app_control_add_extra_data(other_operation, "x", "1");
+  app_control_add_extra_data(other_operation, "y", "2");
+  app_control_h other_uri = create();
+  app_control_set_uri(other_uri, "other");
+  app_control_add_extra_data(other_uri, "x", "1");
+  app_control_add_extra_data(other_uri, "y", "2");
+  app_control_h other_mime = create();
+  app_control_set_mime(other_mime, "text/plain");
+  app_control_add_extra_data(other_mime, "x", "1");
+  app_control_add_extra_data(other_mime, "y", "2");
+  app_control_h other_value = create();
+  app_control_add_extra_data(other_value, "x", "1");
+  app_control_add_extra_data(other_value, "y", "3");
+  // An array of one element is not the same as a single value.
+  app_control_h array = create();
+  const char* values[] = {"1"};
+  app_control_add_extra_data_array(array, "x", values, 1);
+  app_control_add_extra_data(array, "y", "2");
+  // Values which would be the same if they were concatenated.
+  app_control_h split = create();
+  const char* split_values[] = {"", "1"};
+  app_control_add_extra_data_array(split, "x", split_values, 2);
+  app_control_add_extra_data(split, "y", "2");
+
+  for (auto& app_control : app_controls) {
+    coalescer.Add(app_control->get());
+  }
+  EXPECT_EQ(1u, coalescer.GetStats().merged);
+  FakeEcore::RunTimers();
+  EXPECT_EQ(static_cast<uint64_t>(app_controls.size()),
+            coalescer.GetStats().delivered);
+}
+
+TEST(MergedAppControlTakesTheLatestPlace) {
+  EcoreScope scope;
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(),
+                                       kWindowSeconds);
+  Add(coalescer, "first");
+  Add(coalescer, "a");
+  Add(coalescer, "b");
+  Add(coalescer, "a");
+  FakeEcore::RunTimers();
+  std::vector<std::string> expected = {"first", "b", "a"};
+  EXPECT_TRUE(expected == recorder.uris);
+  EXPECT_EQ(1u, coalescer.GetStats().merged);
+}
+
+TEST(OldestIsDroppedWhenTooManyArePending) {
+  EcoreScope scope;
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(), kWindowSeconds,
+                                       nullptr, 2);
+  Add(coalescer, "first");
+  Add(coalescer, "a");
+  Add(coalescer, "b");
+  // Merging does not count towards the limit.
+  Add(coalescer, "a");
+  EXPECT_EQ(0u, coalescer.GetStats().dropped);
+  Add(coalescer, "c");
+  EXPECT_EQ(1u, coalescer.GetStats().dropped);
+  FakeEcore::RunTimers();
+  std::vector<std::string> expected = {"first", "a", "c"};
+  EXPECT_TRUE(expected == recorder.uris);
+}
+
+TEST(ReplyRequestedIsDeliveredImmediately) {
+  EcoreScope scope;
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(),
+                                       kWindowSeconds);
+  Add(coalescer, "first");
+  Add(coalescer, "a");
+  Add(coalescer, "reply", true);
+  Add(coalescer, "reply", true);
+  std::vector<std::string> expected = {"first", "a", "reply", "reply"};
+  EXPECT_TRUE(expected == recorder.uris);
+  EXPECT_EQ(0u, coalescer.GetStats().merged);
+}
+
+TEST(FlushDeliversPending) {
+  EcoreScope scope;
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(),
+                                       kWindowSeconds);
+  Add(coalescer, "first");
+  Add(coalescer, "a");
+  coalescer.Flush();
+  EXPECT_EQ(2u, recorder.uris.size());
+  // Nothing is left for the window.
+  FakeEcore::RunTimers();
+  EXPECT_EQ(2u, recorder.uris.size());
+}
+
+TEST(BackPressureIsOffUntilEnabled) {
+  EcoreScope scope;
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(), kWindowSeconds,
+                                       messenger);
+  EXPECT_EQ(1u, messenger->callbacks.count(kChannel));
+  Add(coalescer, "first");
+  Add(coalescer, "a");
+  FakeEcore::RunTimers();
+  EXPECT_EQ(2u, recorder.uris.size());
+  EXPECT_TRUE(messenger->sent_messages.empty());
+}
+
+TEST(HeldBackUntilDartReplies) {
+  EcoreScope scope;
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(), kWindowSeconds,
+                                       messenger);
+  EXPECT_TRUE(EnableBackPressure(messenger));
+  EXPECT_EQ(1u, messenger->responses.size());
+
+  Add(coalescer, "first");
+  EXPECT_EQ(1u, recorder.uris.size());
+  EXPECT_EQ(1u, messenger->sent_messages.size());
+  Add(coalescer, "a");
+  Add(coalescer, "b");
+  Add(coalescer, "a");
+  FakeEcore::RunTimers();
+  FakeEcore::RunTimers();
+  EXPECT_EQ(1u, recorder.uris.size());
+  EXPECT_EQ(2u, coalescer.GetStats().awaited_windows);
+
+  EXPECT_TRUE(ReplyToAck(messenger));
+  FakeEcore::RunTimers();
+  std::vector<std::string> expected = {"first", "b", "a"};
+  EXPECT_TRUE(expected == recorder.uris);
+  // The delivery is followed by another ack request.
+  EXPECT_EQ(1u, messenger->sent_messages.size());
+
+  // The burst ends while awaiting, but new app controls are still held.
+  FakeEcore::RunTimers();
+  EXPECT_EQ(0u, FakeEcore::GetTimerCount());
+  Add(coalescer, "c");
+  EXPECT_EQ(3u, recorder.uris.size());
+  EXPECT_EQ(1u, FakeEcore::GetTimerCount());
+  EXPECT_TRUE(ReplyToAck(messenger));
+  FakeEcore::RunTimers();
+  EXPECT_EQ(4u, recorder.uris.size());
+
+  // Without pending app controls, the next one is delivered at once.
+  EXPECT_TRUE(ReplyToAck(messenger));
+  FakeEcore::RunTimers();
+  Add(coalescer, "d");
+  EXPECT_EQ(5u, recorder.uris.size());
+}
+
+TEST(DeliveredWhenDartStopsReplying) {
+  EcoreScope scope;
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  Recorder recorder;
+  FlutterAppControlCoalescer coalescer(recorder.GetCallback(), kWindowSeconds,
+                                       messenger);
+  EnableBackPressure(messenger);
+  Add(coalescer, "first");
+  Add(coalescer, "a");
+  for (int i = 1; i < FlutterAppControlCoalescer::kMaxAwaitedWindows; i++) {
+    FakeEcore::RunTimers();
+  }
+  EXPECT_EQ(1u, recorder.uris.size());
+  FakeEcore::RunTimers();
+  EXPECT_EQ(2u, recorder.uris.size());
+
+  // The late reply to the first request is ignored.
+  EXPECT_TRUE(ReplyToAck(messenger));
+  Add(coalescer, "b");
+  EXPECT_EQ(2u, recorder.uris.size());
+  EXPECT_TRUE(ReplyToAck(messenger));
+  FakeEcore::RunTimers();
+  EXPECT_EQ(3u, recorder.uris.size());
+}
+
+TEST(RepliesAfterDestructionAreIgnored) {
+  EcoreScope scope;
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  Recorder recorder;
+  auto coalescer = std::make_unique<FlutterAppControlCoalescer>(
+      recorder.GetCallback(), kWindowSeconds, messenger);
+  EXPECT_EQ(1, messenger->ref_count);
+  EnableBackPressure(messenger);
+  Add(*coalescer, "first");
+  coalescer = nullptr;
+  EXPECT_EQ(0u, messenger->callbacks.count(kChannel));
+  EXPECT_EQ(0, messenger->ref_count);
+  EXPECT_TRUE(ReplyToAck(messenger));
+
+  // A new coalescer starts without back-pressure.
+  coalescer = std::make_unique<FlutterAppControlCoalescer>(
+      recorder.GetCallback(), kWindowSeconds, messenger);
+  Add(*coalescer, "second");
+  EXPECT_TRUE(messenger->sent_messages.empty());
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,431 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Replays long sequences of lifecycle and system events through FlutterApp
+// and FlutterServiceApp, and reports the mean dispatch cost of each kind of
+// event.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../include/flutter_app.h"
+#include "../include/flutter_external_data_stream.h"
+#include "../include/flutter_memory_pressure.h"
+#include "../include/flutter_service_app.h"
+#include "../tizen_log.h"
+#include "fake/fake_dart_api.h"
+#include "fake/fake_flutter_tizen.h"
+#include "fake/fake_tizen.h"
+#include "testing.h"
+
+namespace {
+
+// The number of times each sequence of events is replayed.
+constexpr int kIterations = 2000;
+
+// A low memory warning is delivered every this many iterations, since each
+// one also samples the memory usage of the process.
+constexpr int kLowMemoryInterval = 20;
+
+// Discards log messages, so that the events are not timed with the cost of
+// writing their logs to stderr.
+class NullLogSink : public TizenLogSink {
+ public:
+  void Write(log_priority priority, const char* tag,
+             const char* message) override {}
+};
+
+// Accumulates the time spent dispatching each kind of event.
+class DispatchTimer {
+ public:
+  template <typename Dispatch>
+  void Measure(const char* name, Dispatch dispatch) {
+    auto start = std::chrono::steady_clock::now();
+    dispatch();
+    Entry& entry = entries_[name];
+    entry.total += std::chrono::steady_clock::now() - start;
+    entry.count++;
+  }
+
+  void Print(const char* app_name) const {
+    printf("%s dispatch cost:\n", app_name);
+    for (const auto& [name, entry] : entries_) {
+      double mean_us =
+          std::chrono::duration<double, std::micro>(entry.total).count() /
+          entry.count;
+      printf("  %-28s %6zu events %10.2f us/event\n", name.c_str(),
+             entry.count, mean_us);
+    }
+  }
+
+ private:
+  struct Entry {
+    std::chrono::steady_clock::duration total{0};
+    size_t count = 0;
+  };
+
+  std::map<std::string, Entry> entries_;
+};
+
+// Sends an app control with |uri| to the running app.
+void SendAppControl(const std::string& uri) {
+  app_control_h app_control = nullptr;
+  app_control_create(&app_control);
+  app_control_set_operation(app_control,
+                            "http://tizen.org/appcontrol/operation/view");
+  app_control_set_uri(app_control, uri.c_str());
+  FakeAppMain::SendAppControl(app_control);
+  app_control_destroy(app_control);
+}
+
+app_event_low_memory_status_e GetLowMemoryStatus(int iteration) {
+  return (iteration / kLowMemoryInterval) % 2 == 0
+             ? APP_EVENT_LOW_MEMORY_SOFT_WARNING
+             : APP_EVENT_LOW_MEMORY_HARD_WARNING;
+}
+
+// Returns the state of the fake engine behind |engine|.
+FlutterDesktopEngine* GetFakeEngine(FlutterEngine* engine) {
+  return engine->GetMessenger()->engine;
+}
+
+// Returns the state of the fake main engine of |registry|.
+FlutterDesktopEngine* GetFakeEngine(flutter::PluginRegistry& registry) {
+  return FlutterDesktopPluginRegistrarGetMessenger(
+             registry.GetRegistrarForPlugin("flutter_app_stress_test"))
+      ->engine;
+}
+
+class TestApp : public FlutterApp {
+ public:
+  explicit TestApp(double app_control_coalescing_window = 0.0) {
+    app_control_coalescing_window_ = app_control_coalescing_window;
+  }
+
+  void EnableDeepPause() { is_deep_pause_enabled_ = true; }
+
+  bool ShouldReleaseViewOnLowMemory(int view_id) override {
+    return releasable_view_ids.count(view_id) > 0;
+  }
+
+  // The views released on a hard low memory warning.
+  std::set<int> releasable_view_ids;
+};
+
+class TestServiceApp : public FlutterServiceApp {
+ public:
+  explicit TestServiceApp(double app_control_coalescing_window = 0.0) {
+    app_control_coalescing_window_ = app_control_coalescing_window;
+  }
+};
+
+int RunApp(FlutterApp& app) {
+  char name[] = "flutter_app_stress_test";
+  char* argv[] = {name};
+  return app.Run(1, argv);
+}
+
+int RunApp(FlutterServiceApp& app) {
+  char name[] = "flutter_app_stress_test";
+  char* argv[] = {name};
+  return app.Run(1, argv);
+}
+
+// Runs a test with logs discarded and fresh fakes.
+class StressScope {
+ public:
+  StressScope() {
+    FakeFlutterTizen::Reset();
+    FakeEcore::Reset();
+    TizenLog::SetSink(std::make_unique<NullLogSink>());
+  }
+
+  ~StressScope() {
+    // Let any timers which outlive the app finish.
+    FakeEcore::RunTimers();
+    TizenLog::SetSink(nullptr);
+    FakeEcore::Reset();
+  }
+};
+
+}  // namespace
+
+TEST(FlutterAppDispatchesEventStorm) {
+  StressScope scope;
+  TestApp app;
+  DispatchTimer timer;
+  int low_memory_count = 0;
+  FakeAppMain::SetScript([&]() {
+    int view_id = app.AddView(FlutterDesktopWindowProperties());
+    EXPECT_EQ(1, view_id);
+    for (int i = 0; i < kIterations; i++) {
+      timer.Measure("OnPause", FakeAppMain::Pause);
+      timer.Measure("OnResume", FakeAppMain::Resume);
+      timer.Measure("OnAppControlReceived", [i]() {
+        SendAppControl("app://item/" + std::to_string(i % 10));
+      });
+      timer.Measure("OnLanguageChanged", []() {
+        FakeAppMain::SendEvent(APP_EVENT_LANGUAGE_CHANGED);
+      });
+      timer.Measure("OnRegionFormatChanged", []() {
+        FakeAppMain::SendEvent(APP_EVENT_REGION_FORMAT_CHANGED);
+      });
+      timer.Measure("OnDeviceOrientationChanged", []() {
+        FakeAppMain::SendEvent(APP_EVENT_DEVICE_ORIENTATION_CHANGED);
+      });
+      timer.Measure("OnLowBattery", []() {
+        FakeAppMain::SendEvent(APP_EVENT_LOW_BATTERY);
+      });
+      if (i % kLowMemoryInterval == 0) {
+        timer.Measure("OnLowMemory", [i]() {
+          FakeAppMain::SendEvent(APP_EVENT_LOW_MEMORY, GetLowMemoryStatus(i));
+        });
+        low_memory_count++;
+      }
+    }
+
+    // The launch request is delivered as one more app control, and the app
+    // is resumed once on launch.
+    FlutterDesktopEngine* engine = GetFakeEngine(app);
+    EXPECT_EQ(kIterations + 1, engine->app_control_count);
+    EXPECT_EQ(kIterations + 1, engine->resumed_count);
+    EXPECT_EQ(kIterations, engine->paused_count);
+    EXPECT_EQ(2 * kIterations, engine->locale_change_count);
+    EXPECT_EQ(low_memory_count, engine->low_memory_warning_count);
+
+    // Lifecycle and system events reach additional views too, while app
+    // controls only reach the main view.
+    FlutterDesktopEngine* view_engine = GetFakeEngine(app.GetEngine(view_id));
+    EXPECT_EQ(0, view_engine->app_control_count);
+    EXPECT_EQ(kIterations, view_engine->resumed_count);
+    EXPECT_EQ(kIterations, view_engine->paused_count);
+    EXPECT_EQ(2 * kIterations, view_engine->locale_change_count);
+    EXPECT_EQ(low_memory_count, view_engine->low_memory_warning_count);
+  });
+  EXPECT_EQ(APP_ERROR_NONE, RunApp(app));
+  EXPECT_FALSE(app.IsRunning());
+  EXPECT_EQ(0, FakeFlutterTizen::GetLiveEngineCount());
+  timer.Print("FlutterApp");
+}
+
+TEST(FlutterAppCoalescesAppControlBursts) {
+  StressScope scope;
+  TestApp app(0.1);
+  DispatchTimer timer;
+  FakeAppMain::SetScript([&]() {
+    // The launch request opened a window. End it.
+    FakeEcore::RunTimers();
+    FakeEcore::RunTimers();
+    for (int i = 0; i < kIterations / 10; i++) {
+      // A burst of ten app controls for two items.
+      for (int j = 0; j < 10; j++) {
+        timer.Measure("OnAppControlReceived", [j]() {
+          SendAppControl("app://item/" + std::to_string(j % 2));
+        });
+      }
+      // End the window, and then the burst.
+      FakeEcore::RunTimers();
+      FakeEcore::RunTimers();
+    }
+
+    // The first app control of each burst is delivered at once, and the
+    // other nine are collapsed into one for each item.
+    FlutterAppControlCoalescer::Stats stats = app.GetAppControlStats();
+    EXPECT_EQ(static_cast<uint64_t>(kIterations + 1), stats.received);
+    EXPECT_EQ(static_cast<uint64_t>(kIterations / 10 * 3 + 1),
+              stats.delivered);
+    EXPECT_EQ(static_cast<uint64_t>(kIterations / 10 * 7), stats.merged);
+    EXPECT_EQ(0u, stats.dropped);
+    EXPECT_EQ(static_cast<int>(stats.delivered),
+              GetFakeEngine(app)->app_control_count);
+  });
+  EXPECT_EQ(APP_ERROR_NONE, RunApp(app));
+  timer.Print("FlutterApp (coalescing)");
+}
+
+TEST(FlutterAppStopsWorkWhileDeeplyPaused) {
+  StressScope scope;
+  TestApp app;
+  app.EnableDeepPause();
+  DispatchTimer timer;
+  FakeAppMain::SetScript([&]() {
+    FlutterDesktopMessengerRef messenger =
+        FlutterDesktopPluginRegistrarGetMessenger(
+            app.GetRegistrarForPlugin("flutter_app_stress_test"));
+    auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16);
+    FakeDartApi::OpenPort(42);
+    std::vector<uint8_t> message(16 + 6);
+    int64_t api_data = 1;
+    Dart_Port port = 42;
+    memcpy(message.data(), &api_data, sizeof(api_data));
+    memcpy(message.data() + 8, &port, sizeof(port));
+    memcpy(message.data() + 16, "camera", 6);
+    EXPECT_TRUE(FakeFlutterTizen::SendToCallback(
+        messenger, "tizen/external_data", message));
+
+    FlutterDesktopEngine* engine = GetFakeEngine(app);
+    int view_id = app.AddView(FlutterDesktopWindowProperties());
+    FlutterDesktopEngine* view_engine = GetFakeEngine(app.GetEngine(view_id));
+    for (int i = 0; i < kIterations; i++) {
+      timer.Measure("OnPause", FakeAppMain::Pause);
+      // A producer of 30 frames per pause, e.g. a camera.
+      for (int frame = 0; frame < 30; frame++) {
+        uint8_t* buffer = stream->AcquireBuffer();
+        EXPECT_TRUE(buffer == nullptr);
+        if (buffer) {
+          stream->Post(buffer, 16);
+        }
+      }
+      timer.Measure("OnLanguageChanged", []() {
+        FakeAppMain::SendEvent(APP_EVENT_LANGUAGE_CHANGED);
+      });
+      timer.Measure("OnRegionFormatChanged", []() {
+        FakeAppMain::SendEvent(APP_EVENT_REGION_FORMAT_CHANGED);
+      });
+      // Nothing reaches the engines until resumed.
+      EXPECT_EQ(i, engine->locale_change_count);
+      EXPECT_EQ(i, view_engine->locale_change_count);
+      timer.Measure("OnResume", FakeAppMain::Resume);
+      EXPECT_EQ(i + 1, engine->locale_change_count);
+      EXPECT_EQ(i + 1, view_engine->locale_change_count);
+
+      uint8_t* buffer = stream->AcquireBuffer();
+      EXPECT_TRUE(buffer != nullptr);
+      stream->Post(buffer, 16);
+      FakeDartApi::CollectGarbage();
+    }
+
+    // Only the data produced while resumed has been posted to Dart.
+    EXPECT_EQ(static_cast<uint64_t>(kIterations), stream->GetStats().posted);
+    EXPECT_EQ(static_cast<uint64_t>(kIterations * 30),
+              stream->GetStats().dropped);
+    EXPECT_EQ(kIterations, engine->paused_count);
+  });
+  EXPECT_EQ(APP_ERROR_NONE, RunApp(app));
+  FakeDartApi::Reset();
+  timer.Print("FlutterApp (deep pause)");
+}
+
+TEST(FlutterAppReclaimsMemoryInTiers) {
+  StressScope scope;
+  TestApp app;
+  app.releasable_view_ids = {2};
+  std::vector<std::string> reclaimed;
+  int soft_id = FlutterMemoryPressure::AddReclaimCallback(
+      "soft", 1, FlutterMemoryPressureLevel::kSoft,
+      [&](FlutterMemoryPressureLevel level) { reclaimed.push_back("soft"); });
+  int hard_id = FlutterMemoryPressure::AddReclaimCallback(
+      "hard", 0, FlutterMemoryPressureLevel::kHard,
+      [&](FlutterMemoryPressureLevel level) { reclaimed.push_back("hard"); });
+  FakeAppMain::SetScript([&]() {
+    for (int i = 0; i < 3; i++) {
+      app.AddView(FlutterDesktopWindowProperties());
+    }
+    EXPECT_EQ(1u, app.GetEnginePool()->Prewarm(1));
+    std::vector<FlutterDesktopEngine*> engines;
+    for (int view_id = 0; view_id <= 3; view_id++) {
+      engines.push_back(GetFakeEngine(app.GetEngine(view_id)));
+    }
+
+    // A soft warning only purges the engines.
+    FakeAppMain::SendEvent(APP_EVENT_LOW_MEMORY,
+                           APP_EVENT_LOW_MEMORY_SOFT_WARNING);
+    for (FlutterDesktopEngine* engine : engines) {
+      EXPECT_EQ(1, engine->low_memory_warning_count);
+    }
+    EXPECT_TRUE(app.GetEngine(2) != nullptr);
+    EXPECT_EQ(1u, app.GetEnginePool()->GetSpareCount());
+    EXPECT_TRUE(reclaimed == std::vector<std::string>{"soft"});
+
+    // A hard warning also releases the chosen views and the spare engines.
+    reclaimed.clear();
+    FakeAppMain::SendEvent(APP_EVENT_LOW_MEMORY,
+                           APP_EVENT_LOW_MEMORY_HARD_WARNING);
+    EXPECT_TRUE(app.GetEngine(2) == nullptr);
+    for (int view_id : {0, 1, 3}) {
+      EXPECT_EQ(2, engines[view_id]->low_memory_warning_count);
+    }
+    EXPECT_EQ(0u, app.GetEnginePool()->GetSpareCount());
+    EXPECT_TRUE(reclaimed == (std::vector<std::string>{"hard", "soft"}));
+
+    // Back to normal, nothing is released.
+    reclaimed.clear();
+    FakeAppMain::SendEvent(APP_EVENT_LOW_MEMORY, APP_EVENT_LOW_MEMORY_NORMAL);
+    EXPECT_TRUE(reclaimed.empty());
+    EXPECT_EQ(2, engines[0]->low_memory_warning_count);
+  });
+  EXPECT_EQ(APP_ERROR_NONE, RunApp(app));
+  FlutterMemoryPressure::RemoveReclaimCallback(soft_id);
+  FlutterMemoryPressure::RemoveReclaimCallback(hard_id);
+  EXPECT_EQ(0, FakeFlutterTizen::GetLiveEngineCount());
+}
+
+TEST(FlutterServiceAppDispatchesEventStorm) {
+  StressScope scope;
+  TestServiceApp app;
+  DispatchTimer timer;
+  int low_memory_count = 0;
+  FakeAppMain::SetScript([&]() {
+    EXPECT_EQ(2u, app.SpawnWorkers(2, "worker"));
+    for (int i = 0; i < kIterations; i++) {
+      timer.Measure("OnAppControlReceived", [i]() {
+        SendAppControl("app://item/" + std::to_string(i % 10));
+      });
+      timer.Measure("OnLanguageChanged", []() {
+        FakeAppMain::SendEvent(APP_EVENT_LANGUAGE_CHANGED);
+      });
+      timer.Measure("OnRegionFormatChanged", []() {
+        FakeAppMain::SendEvent(APP_EVENT_REGION_FORMAT_CHANGED);
+      });
+      timer.Measure("OnLowBattery", []() {
+        FakeAppMain::SendEvent(APP_EVENT_LOW_BATTERY);
+      });
+      if (i % kLowMemoryInterval == 0) {
+        timer.Measure("OnLowMemory", [i]() {
+          FakeAppMain::SendEvent(APP_EVENT_LOW_MEMORY, GetLowMemoryStatus(i));
+        });
+        low_memory_count++;
+      }
+    }
+
+    // System events reach the workers too.
+    EXPECT_EQ(2u, app.GetWorkerPool()->GetWorkerCount());
+    FlutterDesktopEngine* engine = GetFakeEngine(app);
+    EXPECT_EQ(kIterations + 1, engine->app_control_count);
+    EXPECT_EQ(2 * kIterations, engine->locale_change_count);
+    EXPECT_EQ(low_memory_count, engine->low_memory_warning_count);
+    for (FlutterEngine* worker : app.GetWorkerPool()->GetEngines()) {
+      EXPECT_EQ(0, GetFakeEngine(worker)->app_control_count);
+      EXPECT_EQ(2 * kIterations, GetFakeEngine(worker)->locale_change_count);
+      EXPECT_EQ(low_memory_count,
+                GetFakeEngine(worker)->low_memory_warning_count);
+    }
+  });
+  EXPECT_EQ(APP_ERROR_NONE, RunApp(app));
+  EXPECT_FALSE(app.IsRunning());
+  EXPECT_EQ(0, FakeFlutterTizen::GetLiveEngineCount());
+  timer.Print("FlutterServiceApp");
+}
+
+TEST(FailedCreateDoesNotTerminate) {
+  StressScope scope;
+  FakeFlutterTizen::SetEngineCreateFails(true);
+  TestServiceApp app;
+  bool is_script_run = false;
+  FakeAppMain::SetScript([&]() { is_script_run = true; });
+  EXPECT_TRUE(RunApp(app) != APP_ERROR_NONE);
+  EXPECT_FALSE(is_script_run);
+  FakeAppMain::SetScript(nullptr);
+  FakeFlutterTizen::SetEngineCreateFails(false);
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,253 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_channel_benchmark.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../include/flutter_standard_message.h"
+#include "fake/fake_flutter_tizen.h"
+#include "testing.h"
+
+namespace {
+
+using Result = FlutterChannelBenchmark::Result;
+using Mode = FlutterChannelBenchmark::Mode;
+using Codec = FlutterChannelBenchmark::Codec;
+
+constexpr char kChannel[] = "tizen/benchmark";
+
+// An engine of the fake engine API, shut down when destroyed unless
+// |Shutdown| has been called.
+class TestEngine {
+ public:
+  TestEngine() {
+    FlutterDesktopEngineProperties properties = {};
+    engine_ = FlutterDesktopEngineCreate(properties);
+  }
+
+  ~TestEngine() { Shutdown(); }
+
+  void Shutdown() {
+    if (engine_) {
+      FlutterDesktopEngineShutdown(engine_);
+      engine_ = nullptr;
+    }
+  }
+
+  FlutterDesktopPluginRegistrarRef GetRegistrar() {
+    return FlutterDesktopEngineGetPluginRegistrar(engine_, "benchmark");
+  }
+
+  FlutterDesktopMessengerRef GetMessenger() {
+    return FlutterDesktopEngineGetMessenger(engine_);
+  }
+
+ private:
+  FlutterDesktopEngineRef engine_ = nullptr;
+};
+
+// Returns what the Dart side of runChannelBenchmarkEcho replies to
+// |message|.
+std::vector<uint8_t> EchoAsDart(Codec codec,
+                                const std::vector<uint8_t>& message) {
+  if (codec == Codec::kBinary) {
+    return message;
+  }
+  FlutterStandardMessageReader reader(message.data(), message.size());
+  FlutterStandardValue method;
+  FlutterStandardValue arguments;
+  if (!reader.Read(method) || method.AsString() != "echo" ||
+      !reader.Read(arguments)) {
+    return {};
+  }
+  std::vector<uint8_t> reply = {0};
+  FlutterStandardMessageWriter writer;
+  writer.WriteUint8List(arguments.data, arguments.length);
+  reply.insert(reply.end(), writer.GetBuffer().begin(),
+               writer.GetBuffer().end());
+  return reply;
+}
+
+// Replies to the messages sent to the Dart side with |reply| until none
+// are left, and returns the number of messages replied to.
+template <typename Reply>
+size_t ReplyAsDart(FlutterDesktopMessengerRef messenger, Reply reply) {
+  size_t count = 0;
+  while (!messenger->sent_messages.empty()) {
+    FakeSentMessage sent_message = std::move(messenger->sent_messages.front());
+    messenger->sent_messages.pop_front();
+    EXPECT_EQ(kChannel, sent_message.channel);
+    std::vector<uint8_t> response = reply(sent_message.message);
+    sent_message.reply(response.data(), response.size(),
+                       sent_message.user_data);
+    count++;
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(LoopbackRunsWithoutEngine) {
+  for (Codec codec : {Codec::kBinary, Codec::kStandardMethod}) {
+    TestEngine engine;
+    FlutterChannelBenchmark benchmark(engine.GetRegistrar(), kChannel,
+                                      Mode::kLoopback, codec);
+    std::vector<Result> results;
+    EXPECT_TRUE(benchmark.Run({1, 64, 4096}, 20,
+                              [&](const std::vector<Result>& done_results) {
+                                results = done_results;
+                              }));
+    // Loopback replies arrive synchronously.
+    EXPECT_FALSE(benchmark.IsRunning());
+    EXPECT_TRUE(engine.GetMessenger()->sent_messages.empty());
+    EXPECT_EQ(3u, results.size());
+    for (const Result& result : results) {
+      EXPECT_EQ(20u, result.message_count);
+      EXPECT_EQ(0u, result.error_count);
+      EXPECT_TRUE(result.p50_latency_ms <= result.p99_latency_ms);
+    }
+    if (results.size() == 3) {
+      EXPECT_EQ(4096u, results[2].payload_size);
+    }
+  }
+}
+
+TEST(EngineRoundTripsGoThroughDart) {
+  for (Codec codec : {Codec::kBinary, Codec::kStandardMethod}) {
+    TestEngine engine;
+    FlutterChannelBenchmark benchmark(engine.GetRegistrar(), kChannel,
+                                      Mode::kEngine, codec);
+    std::vector<Result> results;
+    EXPECT_TRUE(benchmark.Run({8, 300}, 10,
+                              [&](const std::vector<Result>& done_results) {
+                                results = done_results;
+                              }));
+    EXPECT_TRUE(benchmark.IsRunning());
+    // A second run is rejected while the first is in progress.
+    EXPECT_FALSE(benchmark.Run({8}, 1, nullptr));
+
+    size_t count = ReplyAsDart(
+        engine.GetMessenger(), [codec](const std::vector<uint8_t>& message) {
+          return EchoAsDart(codec, message);
+        });
+    EXPECT_EQ(20u, count);
+    EXPECT_FALSE(benchmark.IsRunning());
+    EXPECT_EQ(2u, results.size());
+    for (const Result& result : results) {
+      EXPECT_EQ(10u, result.message_count);
+      EXPECT_EQ(0u, result.error_count);
+    }
+  }
+}
+
+TEST(MismatchedRepliesAreErrors) {
+  for (Codec codec : {Codec::kBinary, Codec::kStandardMethod}) {
+    TestEngine engine;
+    FlutterChannelBenchmark benchmark(engine.GetRegistrar(), kChannel,
+                                      Mode::kEngine, codec);
+    std::vector<Result> results;
+    EXPECT_TRUE(benchmark.Run({16}, 5,
+                              [&](const std::vector<Result>& done_results) {
+                                results = done_results;
+                              }));
+    // The empty reply of a missing handler, and then corrupted echoes.
+    size_t count = 0;
+    ReplyAsDart(engine.GetMessenger(),
+                [&](const std::vector<uint8_t>& message) {
+                  if (count++ == 0) {
+                    return std::vector<uint8_t>();
+                  }
+                  std::vector<uint8_t> reply = EchoAsDart(codec, message);
+                  reply.back() ^= 1;
+                  return reply;
+                });
+    EXPECT_EQ(1u, results.size());
+    if (results.size() == 1) {
+      EXPECT_EQ(0u, results[0].message_count);
+      EXPECT_EQ(5u, results[0].error_count);
+    }
+  }
+}
+
+TEST(EmptyPayloadsAreRejected) {
+  TestEngine engine;
+  FlutterChannelBenchmark benchmark(engine.GetRegistrar(), kChannel,
+                                    Mode::kLoopback);
+  EXPECT_FALSE(benchmark.Run({16, 0}, 1, nullptr));
+  EXPECT_FALSE(benchmark.IsRunning());
+}
+
+TEST(EchoHandlerRepliesWithTheSameContents) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  FlutterChannelBenchmark binary_benchmark(engine.GetRegistrar(), kChannel);
+  binary_benchmark.RegisterEchoHandler();
+  const std::vector<uint8_t> message = {1, 2, 3};
+  EXPECT_TRUE(FakeFlutterTizen::SendToCallback(messenger, kChannel, message));
+  EXPECT_EQ(1u, messenger->responses.size());
+  EXPECT_TRUE(message == messenger->responses.back());
+  EXPECT_EQ(1u, binary_benchmark.GetEchoCount());
+
+  const std::string method_channel = std::string(kChannel) + "/method";
+  FlutterChannelBenchmark method_benchmark(
+      engine.GetRegistrar(), method_channel, Mode::kEngine,
+      Codec::kStandardMethod);
+  method_benchmark.RegisterEchoHandler();
+  FlutterStandardMessageWriter writer;
+  writer.WriteString("echo");
+  writer.WriteUint8List(message.data(), message.size());
+  std::vector<uint8_t> method_call = writer.TakeBuffer();
+  EXPECT_TRUE(
+      FakeFlutterTizen::SendToCallback(messenger, method_channel, method_call));
+  EXPECT_TRUE(EchoAsDart(Codec::kStandardMethod, method_call) ==
+              messenger->responses.back());
+  EXPECT_EQ(1u, method_benchmark.GetEchoCount());
+
+  // Other methods are not implemented.
+  writer.WriteString("other");
+  writer.WriteUint8List(message.data(), message.size());
+  EXPECT_TRUE(FakeFlutterTizen::SendToCallback(messenger, method_channel,
+                                               writer.TakeBuffer()));
+  EXPECT_TRUE(messenger->responses.back().empty());
+  EXPECT_EQ(1u, method_benchmark.GetEchoCount());
+  EXPECT_EQ(1u, binary_benchmark.GetEchoCount());
+}
+
+TEST(BenchmarkOutlivesEngine) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto benchmark = std::make_unique<FlutterChannelBenchmark>(
+      engine.GetRegistrar(), kChannel);
+  benchmark->RegisterEchoHandler();
+  EXPECT_EQ(1, messenger->ref_count);
+
+  // The messenger stays valid until the benchmark releases it.
+  engine.Shutdown();
+  EXPECT_FALSE(FlutterDesktopMessengerIsAvailable(messenger));
+  benchmark.reset();
+
+  TestEngine other_engine;
+  FlutterChannelBenchmark other_benchmark(other_engine.GetRegistrar(),
+                                          kChannel);
+  other_benchmark.RegisterEchoHandler();
+  EXPECT_EQ(1u, other_engine.GetMessenger()->callbacks.size());
+}
+
+TEST(EchoHandlerIsRemovedOnDestruction) {
+  TestEngine engine;
+  {
+    FlutterChannelBenchmark benchmark(engine.GetRegistrar(), kChannel);
+    benchmark.RegisterEchoHandler();
+    EXPECT_EQ(1u, engine.GetMessenger()->callbacks.size());
+  }
+  EXPECT_EQ(0u, engine.GetMessenger()->callbacks.size());
+  EXPECT_EQ(0, engine.GetMessenger()->ref_count);
+}
+
+int main() {
+  return RunAllTests();
+}
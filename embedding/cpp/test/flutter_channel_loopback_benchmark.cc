@@ -0,0 +1,62 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs FlutterChannelBenchmark in loopback mode against the fake engine,
+// which measures the native side cost of platform channel messages.
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "../include/flutter_channel_benchmark.h"
+#include "../tizen_log.h"
+
+namespace {
+
+using Result = FlutterChannelBenchmark::Result;
+using Codec = FlutterChannelBenchmark::Codec;
+
+// The number of round trips per payload size.
+constexpr size_t kMessageCount = 20000;
+
+// Discards the results logged by the benchmark, which are printed instead.
+class NullLogSink : public TizenLogSink {
+ public:
+  void Write(log_priority priority, const char* tag,
+             const char* message) override {}
+};
+
+void RunLoopback(FlutterDesktopPluginRegistrarRef registrar, Codec codec,
+                 const char* name) {
+  FlutterChannelBenchmark benchmark(registrar, "tizen/benchmark",
+                                    FlutterChannelBenchmark::Mode::kLoopback,
+                                    codec);
+  benchmark.Run({16, 1024, 65536}, kMessageCount,
+                [name](const std::vector<Result>& results) {
+                  printf("%s loopback:\n", name);
+                  for (const Result& result : results) {
+                    printf(
+                        "  %6zu B %10.0f msg/s %10.2f MB/s "
+                        "p50 %.4f ms p99 %.4f ms\n",
+                        result.payload_size, result.messages_per_second,
+                        result.bytes_per_second / (1024 * 1024),
+                        result.p50_latency_ms, result.p99_latency_ms);
+                  }
+                });
+}
+
+}  // namespace
+
+int main() {
+  TizenLog::SetSink(std::make_unique<NullLogSink>());
+  FlutterDesktopEngineProperties properties = {};
+  FlutterDesktopEngineRef engine = FlutterDesktopEngineCreate(properties);
+  FlutterDesktopPluginRegistrarRef registrar =
+      FlutterDesktopEngineGetPluginRegistrar(engine, "benchmark");
+  RunLoopback(registrar, Codec::kBinary, "Binary");
+  RunLoopback(registrar, Codec::kStandardMethod, "Standard method");
+  FlutterDesktopEngineShutdown(engine);
+  TizenLog::SetSink(nullptr);
+  return 0;
+}
@@ -0,0 +1,198 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_engine_arguments.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+using Metadata = FlutterEngineArguments::Metadata;
+using MetadataValue = FlutterEngineArguments::MetadataValue;
+
+// The offset of |enable_impeller| in the header of a cache file.
+constexpr size_t kEnableImpellerOffset = 32;
+
+// The size of the header of a cache file, which the key follows.
+constexpr size_t kHeaderSize = 40;
+
+constexpr char kCacheKey[] = "org.tizen.example";
+
+// A cache file in a temporary directory, removed when destroyed.
+class TestCache {
+ public:
+  TestCache() {
+    char directory[] = "/tmp/engine_arguments_test_XXXXXX";
+    directory_ = mkdtemp(directory);
+    path_ = directory_ + "/cache";
+    manifest_stat_.st_mtim.tv_sec = 1700000000;
+    manifest_stat_.st_mtim.tv_nsec = 123456789;
+    manifest_stat_.st_size = 4096;
+  }
+
+  ~TestCache() {
+    std::string command = "rm -rf " + directory_;
+    system(command.c_str());
+  }
+
+  void Write(const Metadata& metadata,
+             const std::string& cache_key = kCacheKey) {
+    FlutterEngineArguments::WriteMetadataCache(path_, cache_key,
+                                               manifest_stat_, metadata);
+  }
+
+  bool Read(Metadata& metadata,
+            const std::string& cache_key = kCacheKey) const {
+    return FlutterEngineArguments::ReadMetadataCache(path_, cache_key,
+                                                     manifest_stat_, metadata);
+  }
+
+  std::vector<uint8_t> GetContents() const {
+    std::vector<uint8_t> contents;
+    FILE* file = fopen(path_.c_str(), "rb");
+    if (file) {
+      int byte;
+      while ((byte = fgetc(file)) != EOF) {
+        contents.push_back(static_cast<uint8_t>(byte));
+      }
+      fclose(file);
+    }
+    return contents;
+  }
+
+  void SetContents(const std::vector<uint8_t>& contents) {
+    FILE* file = fopen(path_.c_str(), "wb");
+    if (!contents.empty()) {
+      fwrite(contents.data(), 1, contents.size(), file);
+    }
+    fclose(file);
+  }
+
+  // Whether the directory holds anything but the cache file.
+  bool HasOtherFiles() const {
+    std::string command = "test $(ls -A " + directory_ + " | wc -l) -gt 1";
+    return system(command.c_str()) == 0;
+  }
+
+  struct stat& manifest_stat() { return manifest_stat_; }
+
+ private:
+  std::string directory_;
+  std::string path_;
+  struct stat manifest_stat_ = {};
+};
+
+Metadata CreateMetadata() {
+  Metadata metadata;
+  metadata.enable_impeller = MetadataValue::kTrue;
+  metadata.enable_flutter_gpu = MetadataValue::kFalse;
+  return metadata;
+}
+
+}  // namespace
+
+TEST(CacheRoundTrips) {
+  TestCache cache;
+  Metadata metadata;
+  EXPECT_FALSE(cache.Read(metadata));
+
+  cache.Write(CreateMetadata());
+  EXPECT_TRUE(cache.Read(metadata));
+  EXPECT_TRUE(metadata.enable_impeller == MetadataValue::kTrue);
+  EXPECT_TRUE(metadata.enable_flutter_gpu == MetadataValue::kFalse);
+  EXPECT_EQ(kHeaderSize + sizeof(kCacheKey) - 1, cache.GetContents().size());
+  // The temporary file has been renamed over the cache.
+  EXPECT_FALSE(cache.HasOtherFiles());
+
+  // A later write replaces the cache.
+  Metadata unset;
+  cache.Write(unset);
+  EXPECT_TRUE(cache.Read(metadata));
+  EXPECT_TRUE(metadata.enable_impeller == MetadataValue::kNotSet);
+}
+
+TEST(BadMagicIsRejected) {
+  TestCache cache;
+  cache.Write(CreateMetadata());
+  std::vector<uint8_t> contents = cache.GetContents();
+  contents[0] ^= 0xff;
+  cache.SetContents(contents);
+  Metadata metadata;
+  EXPECT_FALSE(cache.Read(metadata));
+  EXPECT_TRUE(metadata.enable_impeller == MetadataValue::kNotSet);
+}
+
+TEST(TruncatedFileIsRejected) {
+  TestCache cache;
+  cache.Write(CreateMetadata());
+  std::vector<uint8_t> contents = cache.GetContents();
+  for (size_t size : {size_t{0}, kHeaderSize - 1, kHeaderSize,
+                      contents.size() - 1}) {
+    cache.SetContents(std::vector<uint8_t>(contents.begin(),
+                                           contents.begin() + size));
+    Metadata metadata;
+    EXPECT_FALSE(cache.Read(metadata));
+  }
+  cache.SetContents(contents);
+  Metadata metadata;
+  EXPECT_TRUE(cache.Read(metadata));
+}
+
+TEST(KeyMismatchIsRejected) {
+  TestCache cache;
+  cache.Write(CreateMetadata());
+  Metadata metadata;
+  EXPECT_FALSE(cache.Read(metadata, "org.tizen.other"));
+  EXPECT_FALSE(cache.Read(metadata, "org.tizen.exampl"));
+  EXPECT_FALSE(cache.Read(metadata, std::string(kCacheKey) + "2"));
+  EXPECT_FALSE(cache.Read(metadata, ""));
+
+  // A key of the former format, which also held the app version.
+  cache.Write(CreateMetadata(), std::string(kCacheKey) + "\n1.0.0");
+  EXPECT_FALSE(cache.Read(metadata));
+}
+
+TEST(OutOfRangeValuesAreRejected) {
+  TestCache cache;
+  cache.Write(CreateMetadata());
+  std::vector<uint8_t> contents = cache.GetContents();
+  EXPECT_EQ(static_cast<uint8_t>(MetadataValue::kTrue),
+            contents[kEnableImpellerOffset]);
+  for (size_t offset : {kEnableImpellerOffset, kEnableImpellerOffset + 1}) {
+    std::vector<uint8_t> corrupted = contents;
+    corrupted[offset] = static_cast<uint8_t>(MetadataValue::kTrue) + 1;
+    cache.SetContents(corrupted);
+    Metadata metadata;
+    EXPECT_FALSE(cache.Read(metadata));
+  }
+}
+
+TEST(StaleManifestIsRejected) {
+  TestCache cache;
+  cache.Write(CreateMetadata());
+  Metadata metadata;
+
+  cache.manifest_stat().st_mtim.tv_nsec++;
+  EXPECT_FALSE(cache.Read(metadata));
+  cache.manifest_stat().st_mtim.tv_nsec--;
+  cache.manifest_stat().st_mtim.tv_sec++;
+  EXPECT_FALSE(cache.Read(metadata));
+  cache.manifest_stat().st_mtim.tv_sec--;
+  cache.manifest_stat().st_size++;
+  EXPECT_FALSE(cache.Read(metadata));
+  cache.manifest_stat().st_size--;
+  EXPECT_TRUE(cache.Read(metadata));
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,128 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_engine_pool.h"
+
+#include "fake/fake_flutter_tizen.h"
+#include "testing.h"
+
+namespace {
+
+// Whether a view can be created for |engine|, as FlutterApp does.
+bool CanCreateView(std::unique_ptr<FlutterEngine> engine) {
+  FlutterDesktopWindowProperties window_prop = {};
+  FlutterDesktopViewRef view = FlutterDesktopViewCreateFromNewWindow(
+      window_prop, engine->RelinquishEngine());
+  if (!view) {
+    return false;
+  }
+  FlutterDesktopViewDestroy(view);
+  return true;
+}
+
+}  // namespace
+
+TEST(PrewarmKeepsRunningEnginesApart) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool;
+  EXPECT_EQ(2u, pool.Prewarm(2));
+  EXPECT_EQ(1u, pool.Prewarm(1, true));
+  EXPECT_EQ(2u, pool.GetSpareCount());
+  EXPECT_EQ(1u, pool.GetRunningSpareCount());
+  EXPECT_EQ(3, FakeFlutterTizen::GetLiveEngineCount());
+}
+
+TEST(AcquireNeverReturnsRunningEngine) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool;
+  pool.Prewarm(2, true);
+  std::unique_ptr<FlutterEngine> engine = pool.Acquire();
+  EXPECT_TRUE(engine != nullptr);
+  EXPECT_FALSE(engine->IsRunning());
+  EXPECT_EQ(2u, pool.GetRunningSpareCount());
+  EXPECT_TRUE(CanCreateView(std::move(engine)));
+}
+
+TEST(AcquireTakesSpareEngine) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool;
+  pool.Prewarm(1);
+  std::unique_ptr<FlutterEngine> engine = pool.Acquire();
+  EXPECT_EQ(0u, pool.GetSpareCount());
+  EXPECT_EQ(1, FakeFlutterTizen::GetCreatedEngineCount());
+  EXPECT_TRUE(CanCreateView(std::move(engine)));
+  EXPECT_EQ(0, FakeFlutterTizen::GetLiveEngineCount());
+}
+
+TEST(AcquireRunningTakesRunningSpareEngine) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool;
+  pool.Prewarm(1);
+  pool.Prewarm(1, true);
+  std::unique_ptr<FlutterEngine> engine = pool.AcquireRunning();
+  EXPECT_TRUE(engine != nullptr);
+  EXPECT_TRUE(engine->IsRunning());
+  EXPECT_EQ(0u, pool.GetRunningSpareCount());
+  EXPECT_EQ(1u, pool.GetSpareCount());
+  EXPECT_EQ(2, FakeFlutterTizen::GetCreatedEngineCount());
+}
+
+TEST(AcquireRunningStartsNewEngine) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool;
+  pool.Prewarm(1);
+  std::unique_ptr<FlutterEngine> engine = pool.AcquireRunning();
+  EXPECT_TRUE(engine != nullptr);
+  EXPECT_TRUE(engine->IsRunning());
+  EXPECT_EQ(1u, pool.GetSpareCount());
+  EXPECT_EQ(2, FakeFlutterTizen::GetCreatedEngineCount());
+}
+
+TEST(AcquireWithOtherEntrypointCreatesNewEngine) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool("main", {"a"});
+  pool.Prewarm(1);
+  std::unique_ptr<FlutterEngine> other = pool.Acquire("other", {"a"});
+  EXPECT_EQ(1u, pool.GetSpareCount());
+  std::unique_ptr<FlutterEngine> same = pool.Acquire("main", {"a"});
+  EXPECT_EQ(0u, pool.GetSpareCount());
+  EXPECT_EQ(2, FakeFlutterTizen::GetCreatedEngineCount());
+}
+
+TEST(AcquireFailsWithoutEngine) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool;
+  FakeFlutterTizen::SetEngineCreateFails(true);
+  EXPECT_EQ(0u, pool.Prewarm(1, true));
+  EXPECT_TRUE(pool.Acquire() == nullptr);
+  EXPECT_TRUE(pool.AcquireRunning() == nullptr);
+  FakeFlutterTizen::SetEngineCreateFails(false);
+}
+
+TEST(ClearDestroysAllSpareEngines) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool;
+  pool.Prewarm(2);
+  pool.Prewarm(2, true);
+  pool.Clear();
+  EXPECT_EQ(0u, pool.GetSpareCount());
+  EXPECT_EQ(0u, pool.GetRunningSpareCount());
+  EXPECT_EQ(0, FakeFlutterTizen::GetLiveEngineCount());
+}
+
+TEST(MemoryStatsAreCreatedOnDemand) {
+  FakeFlutterTizen::Reset();
+  FlutterEnginePool pool;
+  pool.Prewarm(1);
+  std::unique_ptr<FlutterEngine> engine = pool.Acquire();
+  FlutterDesktopMessengerRef messenger = engine->GetMessenger();
+  EXPECT_TRUE(messenger->callbacks.empty());
+  EXPECT_TRUE(engine->GetMemoryStats() != nullptr);
+  EXPECT_EQ(1u, messenger->callbacks.count("tizen/memory_usage"));
+  EXPECT_EQ(engine->GetMemoryStats(), engine->GetMemoryStats());
+}
+
+int main() {
+  return RunAllTests();
+}
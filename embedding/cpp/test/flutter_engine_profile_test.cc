@@ -0,0 +1,189 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_engine_profile.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+// An engine profile file, removed when destroyed.
+class TestProfile {
+ public:
+  explicit TestProfile(const std::string& content) {
+    char path[] = "/tmp/engine_profile_test_XXXXXX";
+    int fd = mkstemp(path);
+    write(fd, content.data(), content.size());
+    close(fd);
+    path_ = path;
+  }
+
+  ~TestProfile() { remove(path_.c_str()); }
+
+  // Evaluates the profile for |device| into |settings|.
+  bool Evaluate(const FlutterDeviceInfo& device,
+                FlutterEngineProfileSettings& settings,
+                std::string& error) const {
+    return FlutterEngineProfile::Evaluate(path_, device, settings, error);
+  }
+
+  const std::string& path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+FlutterDeviceInfo CreateDevice(int64_t memory_mb, int64_t cpu_count,
+                               const std::string& profile) {
+  FlutterDeviceInfo device;
+  device.memory_mb = memory_mb;
+  device.cpu_count = cpu_count;
+  device.profile = profile;
+  return device;
+}
+
+constexpr char kProfile[] = R"(
+# Low end devices.
+[memory_mb < 1024]
+--old-gen-heap-size=128
+pixel_ratio = 1.0
+
+[profile == tv, memory_mb >= 2048, cpu_count >= 4]
+--old-gen-heap-size=512
+--enable-impeller
+renderer = vulkan
+
+[profile != tv]
+renderer = egl
+)";
+
+}  // namespace
+
+TEST(MissingFileLeavesSettings) {
+  FlutterEngineProfileSettings settings;
+  settings.switches = {"--verbose-logging"};
+  std::string error;
+  EXPECT_TRUE(FlutterEngineProfile::Evaluate(
+      "/nonexistent/engine_profile", CreateDevice(512, 2, "tv"), settings,
+      error));
+  EXPECT_EQ(1u, settings.switches.size());
+  EXPECT_TRUE(error.empty());
+}
+
+TEST(RulesMatchTheDevice) {
+  TestProfile profile(kProfile);
+  std::string error;
+
+  FlutterEngineProfileSettings low_end;
+  EXPECT_TRUE(profile.Evaluate(CreateDevice(512, 2, "tv"), low_end, error));
+  EXPECT_TRUE(low_end.switches ==
+              std::vector<std::string>{"--old-gen-heap-size=128"});
+  EXPECT_TRUE(low_end.pixel_ratio == 1.0);
+  EXPECT_FALSE(low_end.renderer_type.has_value());
+
+  FlutterEngineProfileSettings high_end;
+  EXPECT_TRUE(profile.Evaluate(CreateDevice(4096, 8, "tv"), high_end, error));
+  EXPECT_TRUE(high_end.switches ==
+              (std::vector<std::string>{"--old-gen-heap-size=512",
+                                        "--enable-impeller"}));
+  EXPECT_FALSE(high_end.pixel_ratio.has_value());
+  EXPECT_TRUE(high_end.renderer_type == FlutterDesktopRendererType::kVulkan);
+
+  // All of the conditions of a rule must hold.
+  FlutterEngineProfileSettings few_cores;
+  EXPECT_TRUE(profile.Evaluate(CreateDevice(4096, 2, "tv"), few_cores, error));
+  EXPECT_TRUE(few_cores.switches.empty());
+  EXPECT_FALSE(few_cores.renderer_type.has_value());
+
+  FlutterEngineProfileSettings common;
+  EXPECT_TRUE(
+      profile.Evaluate(CreateDevice(4096, 8, "common"), common, error));
+  EXPECT_TRUE(common.switches.empty());
+  EXPECT_TRUE(common.renderer_type == FlutterDesktopRendererType::kEGL);
+  EXPECT_TRUE(error.empty());
+}
+
+TEST(LaterRulesTakePrecedence) {
+  TestProfile profile(R"(
+[]
+--old-gen-heap-size=256
+--enable-impeller
+pixel_ratio = 2.0
+renderer = vulkan
+
+[cpu_count >= 4]
+--old-gen-heap-size=512
+pixel_ratio = 1.5
+
+[cpu_count >= 16]
+renderer = egl
+)");
+  FlutterEngineProfileSettings settings;
+  // A switch set before evaluation is replaced in the same way.
+  settings.switches = {"--old-gen-heap-size=64", "--verbose-logging"};
+  std::string error;
+  EXPECT_TRUE(profile.Evaluate(CreateDevice(1024, 4, "tv"), settings, error));
+  EXPECT_TRUE(settings.switches ==
+              (std::vector<std::string>{"--verbose-logging",
+                                        "--enable-impeller",
+                                        "--old-gen-heap-size=512"}));
+  EXPECT_TRUE(settings.pixel_ratio == 1.5);
+  // A rule which does not match leaves the setting of an earlier one.
+  EXPECT_TRUE(settings.renderer_type == FlutterDesktopRendererType::kVulkan);
+}
+
+TEST(MalformedLinesAreRejected) {
+  const std::vector<std::pair<std::string, int>> cases = {
+      {"[memory_mb < 1024\n--old-gen-heap-size=128\n", 1},
+      {"# Comment\n--old-gen-heap-size=128\n", 2},
+      {"[]\n\n[memory < 1024]\n", 3},
+      {"[memory_mb < 1k]\n", 1},
+      {"[profile < tv]\n", 1},
+      {"[memory_mb ~ 1024]\n", 1},
+      {"[cpu_count > 2,, memory_mb > 0]\n", 1},
+      {"[]\npixel_ratio\n", 2},
+      {"[]\npixel_ratio = 0\n", 2},
+      {"[]\npixel_ratio = fast\n", 2},
+      {"[]\nrenderer = metal\n", 2},
+      {"[]\nframe_rate = 60\n", 2},
+      // Settings of rules which do not match are validated as well.
+      {"[cpu_count > 1024]\nrenderer = metal\n", 2},
+  };
+  for (const auto& [content, line] : cases) {
+    TestProfile profile(content);
+    FlutterEngineProfileSettings settings;
+    settings.switches = {"--verbose-logging"};
+    std::string error;
+    EXPECT_FALSE(
+        profile.Evaluate(CreateDevice(512, 2, "tv"), settings, error));
+    std::string location = profile.path() + ":" + std::to_string(line) + ":";
+    EXPECT_EQ(0u, error.rfind(location, 0));
+    // Nothing is applied from an invalid profile.
+    EXPECT_EQ(1u, settings.switches.size());
+    EXPECT_FALSE(settings.pixel_ratio.has_value());
+  }
+}
+
+TEST(EmptyConditionsAlwaysHold) {
+  TestProfile profile("[ ]\n  --enable-impeller  \r\n[cpu_count > 0,]\n"
+                      "pixel_ratio = 1.25\n");
+  FlutterEngineProfileSettings settings;
+  std::string error;
+  EXPECT_TRUE(profile.Evaluate(CreateDevice(0, 1, ""), settings, error));
+  EXPECT_TRUE(settings.switches ==
+              std::vector<std::string>{"--enable-impeller"});
+  EXPECT_TRUE(settings.pixel_ratio == 1.25);
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,149 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_engine_threads.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+// The highest CPU usage of the process allowed while throttled, as a
+// fraction of one CPU.
+//
+// Three threads at nice 19 get about 4% of a CPU shared with one thread at
+// nice 0, regardless of how much work they have.
+constexpr double kIdleCpuTarget = 0.1;
+
+// How long the app stays paused.
+constexpr std::chrono::milliseconds kPauseDuration(1000);
+
+// Runs all threads on CPU 0 so that they compete with each other.
+void PinToFirstCpu(pid_t tid) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(0, &cpu_set);
+  sched_setaffinity(tid, sizeof(cpu_set), &cpu_set);
+}
+
+// Stand-ins for the UI, raster and I/O threads of an engine which keep
+// running while the app is paused, e.g. because of a plugin event stream
+// which the framework does not pause.
+class BusyEngineThreads {
+ public:
+  BusyEngineThreads() {
+    for (const char *name : {"1.ui", "1.raster", "1.io"}) {
+      threads_.emplace_back([this, name]() {
+        pthread_setname_np(pthread_self(), name);
+        PinToFirstCpu(0);
+        started_count_++;
+        while (!is_stopped_) {
+        }
+      });
+    }
+    while (started_count_ < threads_.size()) {
+      std::this_thread::yield();
+    }
+  }
+
+  ~BusyEngineThreads() {
+    is_stopped_ = true;
+    for (std::thread &thread : threads_) {
+      thread.join();
+    }
+  }
+
+ private:
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> started_count_{0};
+  std::atomic<bool> is_stopped_{false};
+};
+
+// Another process keeping CPU 0 busy at the default priority, like the app
+// in the foreground.
+class ForegroundProcess {
+ public:
+  ForegroundProcess() {
+    pid_ = fork();
+    if (pid_ == 0) {
+      PinToFirstCpu(0);
+      while (true) {
+      }
+    }
+  }
+
+  ~ForegroundProcess() {
+    kill(pid_, SIGKILL);
+    waitpid(pid_, nullptr, 0);
+  }
+
+ private:
+  pid_t pid_;
+};
+
+// Pauses for |kPauseDuration| and returns the CPU usage while paused.
+double MeasurePausedCpuUsage(bool is_throttled) {
+  ForegroundProcess foreground;
+  BusyEngineThreads engine_threads;
+  FlutterEngineThrottler throttler;
+  throttler.Throttle(is_throttled ? 19 : 0);
+  std::this_thread::sleep_for(kPauseDuration);
+  throttler.Restore();
+  EXPECT_FALSE(throttler.IsThrottled());
+  return throttler.GetLastPauseStats().GetCpuUsage();
+}
+
+}  // namespace
+
+TEST(UnthrottledThreadsMissIdleCpuTarget) {
+  double usage = MeasurePausedCpuUsage(false);
+  printf("Unthrottled CPU usage: %.1f%%\n", usage * 100);
+  EXPECT_TRUE(usage > kIdleCpuTarget);
+}
+
+TEST(ThrottledThreadsMeetIdleCpuTarget) {
+  if (!FlutterEngineThrottler::IsSupported()) {
+    printf("Skipped: thread priorities cannot be restored.\n");
+    return;
+  }
+  double usage = MeasurePausedCpuUsage(true);
+  printf("Throttled CPU usage: %.1f%%\n", usage * 100);
+  EXPECT_TRUE(usage < kIdleCpuTarget);
+}
+
+TEST(RestoreRestoresNiceValues) {
+  if (!FlutterEngineThrottler::IsSupported()) {
+    printf("Skipped: thread priorities cannot be restored.\n");
+    return;
+  }
+  BusyEngineThreads engine_threads;
+  FlutterEngineThrottler throttler;
+  throttler.Throttle(19);
+  for (const FlutterEngineThreadPlacement &placement :
+       FlutterEngineThreads::GetPlacement()) {
+    bool is_platform =
+        placement.thread.type == FlutterEngineThreadType::kPlatform;
+    EXPECT_EQ(is_platform ? 0 : 19, placement.nice_value);
+  }
+  throttler.Restore();
+  for (const FlutterEngineThreadPlacement &placement :
+       FlutterEngineThreads::GetPlacement()) {
+    EXPECT_EQ(0, placement.nice_value);
+  }
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,272 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_external_data_stream.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fake/fake_dart_api.h"
+#include "fake/fake_flutter_tizen.h"
+#include "testing.h"
+
+namespace {
+
+constexpr char kChannel[] = "tizen/external_data";
+
+// Any non-null address passes as the API table of the fake Dart API.
+constexpr int64_t kApiData = 0x1000;
+
+// An engine of the fake engine API, shut down when destroyed unless
+// |Shutdown| has been called.
+class TestEngine {
+ public:
+  TestEngine() {
+    FlutterDesktopEngineProperties properties = {};
+    engine_ = FlutterDesktopEngineCreate(properties);
+  }
+
+  ~TestEngine() {
+    Shutdown();
+    FakeDartApi::Reset();
+  }
+
+  void Shutdown() {
+    if (engine_) {
+      FlutterDesktopEngineShutdown(engine_);
+      engine_ = nullptr;
+    }
+  }
+
+  FlutterDesktopMessengerRef GetMessenger() {
+    return FlutterDesktopEngineGetMessenger(engine_);
+  }
+
+ private:
+  FlutterDesktopEngineRef engine_ = nullptr;
+};
+
+// Sends the connection message of the Dart side, which listens to the
+// stream named |name| on |port|.
+bool Connect(FlutterDesktopMessengerRef messenger, const std::string& name,
+             Dart_Port port) {
+  std::vector<uint8_t> message(16 + name.size());
+  memcpy(message.data(), &kApiData, sizeof(kApiData));
+  memcpy(message.data() + 8, &port, sizeof(port));
+  memcpy(message.data() + 16, name.data(), name.size());
+  return FakeFlutterTizen::SendToCallback(messenger, kChannel, message);
+}
+
+}  // namespace
+
+TEST(PostsBuffersOnceConnected) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16, 2);
+  EXPECT_TRUE(stream != nullptr);
+  EXPECT_FALSE(stream->IsConnected());
+  EXPECT_TRUE(stream->AcquireBuffer() == nullptr);
+
+  FakeDartApi::OpenPort(42);
+  EXPECT_TRUE(Connect(messenger, "camera", 42));
+  EXPECT_TRUE(stream->IsConnected());
+  EXPECT_EQ(1u, messenger->responses.size());
+  EXPECT_EQ(1, FakeDartApi::GetInitializeCount());
+
+  uint8_t* buffer = stream->AcquireBuffer();
+  EXPECT_TRUE(buffer != nullptr);
+  memset(buffer, 7, 16);
+  EXPECT_TRUE(stream->Post(buffer, 10));
+  EXPECT_EQ(1u, FakeDartApi::GetHeldData().size());
+  const FakeExternalData& data = FakeDartApi::GetHeldData().back();
+  EXPECT_EQ(42, data.port);
+  EXPECT_TRUE(data.data == buffer);
+  EXPECT_EQ(10, data.length);
+  EXPECT_EQ(1u, stream->GetStats().posted);
+  EXPECT_EQ(0u, stream->GetStats().dropped);
+}
+
+TEST(BuffersAreReusedOnceCollected) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16, 2);
+  FakeDartApi::OpenPort(42);
+  Connect(messenger, "camera", 42);
+
+  uint8_t* first = stream->AcquireBuffer();
+  uint8_t* second = stream->AcquireBuffer();
+  EXPECT_TRUE(first != nullptr && second != nullptr && first != second);
+  EXPECT_TRUE(stream->Post(first, 16));
+  EXPECT_TRUE(stream->Post(second, 16));
+  // All buffers are held by Dart.
+  EXPECT_TRUE(stream->AcquireBuffer() == nullptr);
+  EXPECT_EQ(1u, stream->GetStats().dropped);
+
+  EXPECT_EQ(2u, FakeDartApi::CollectGarbage());
+  EXPECT_TRUE(stream->AcquireBuffer() == first);
+
+  // A buffer which is not posted is returned by the producer.
+  EXPECT_TRUE(stream->AcquireBuffer() == second);
+  stream->ReleaseBuffer(second);
+  EXPECT_TRUE(stream->AcquireBuffer() == second);
+  EXPECT_EQ(2u, stream->GetStats().posted);
+}
+
+TEST(DisconnectStopsPosting) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16, 1);
+  FakeDartApi::OpenPort(42);
+  Connect(messenger, "camera", 42);
+  uint8_t* buffer = stream->AcquireBuffer();
+  EXPECT_TRUE(buffer != nullptr);
+
+  EXPECT_TRUE(Connect(messenger, "camera", ILLEGAL_PORT));
+  EXPECT_FALSE(stream->IsConnected());
+  // The buffer taken before disconnecting is released by Post.
+  EXPECT_FALSE(stream->Post(buffer, 16));
+  EXPECT_TRUE(FakeDartApi::GetHeldData().empty());
+
+  Connect(messenger, "camera", 42);
+  EXPECT_TRUE(stream->AcquireBuffer() == buffer);
+}
+
+TEST(PortIsHandedOverOnReconnect) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16, 2);
+  FakeDartApi::OpenPort(1);
+  Connect(messenger, "camera", 1);
+  uint8_t* first = stream->AcquireBuffer();
+  EXPECT_TRUE(stream->Post(first, 16));
+
+  // e.g. a hot restart, which creates a new isolate listening on a new
+  // port and closes the old one.
+  FakeDartApi::OpenPort(2);
+  Connect(messenger, "camera", 2);
+  FakeDartApi::ClosePort(1);
+  uint8_t* second = stream->AcquireBuffer();
+  EXPECT_TRUE(stream->Post(second, 16));
+  EXPECT_EQ(2u, FakeDartApi::GetHeldData().size());
+  EXPECT_EQ(2, FakeDartApi::GetHeldData().back().port);
+
+  // The data held by the old isolate is still returned once collected.
+  EXPECT_EQ(1u, FakeDartApi::CollectGarbage(1));
+  EXPECT_TRUE(stream->AcquireBuffer() == first);
+  // The API table is only initialized once per process.
+  EXPECT_EQ(1, FakeDartApi::GetInitializeCount());
+}
+
+TEST(ClosedPortReleasesBuffer) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16, 1);
+  Connect(messenger, "camera", 42);
+  uint8_t* buffer = stream->AcquireBuffer();
+  // The port is not open, so the message is not enqueued.
+  EXPECT_FALSE(stream->Post(buffer, 16));
+  EXPECT_EQ(0u, stream->GetStats().posted);
+  EXPECT_TRUE(stream->AcquireBuffer() == buffer);
+}
+
+TEST(InvalidPostsAreRejected) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16, 2);
+  FakeDartApi::OpenPort(42);
+  Connect(messenger, "camera", 42);
+  uint8_t* buffer = stream->AcquireBuffer();
+  EXPECT_FALSE(stream->Post(buffer, 17));
+  EXPECT_FALSE(stream->Post(buffer + 1, 8));
+  uint8_t other[16];
+  EXPECT_FALSE(stream->Post(other, 16));
+  EXPECT_TRUE(FakeDartApi::GetHeldData().empty());
+}
+
+TEST(StreamsAreMatchedByName) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto camera = FlutterExternalDataStream::Create(messenger, "camera", 16);
+  auto sensor = FlutterExternalDataStream::Create(messenger, "sensor", 16);
+  EXPECT_TRUE(FlutterExternalDataStream::Create(messenger, "camera", 16) ==
+              nullptr);
+
+  Connect(messenger, "sensor", 42);
+  EXPECT_FALSE(camera->IsConnected());
+  EXPECT_TRUE(sensor->IsConnected());
+  Connect(messenger, "microphone", 43);
+  EXPECT_FALSE(camera->IsConnected());
+
+  // Streams of another engine are separate.
+  TestEngine other_engine;
+  auto other_camera = FlutterExternalDataStream::Create(
+      other_engine.GetMessenger(), "camera", 16);
+  EXPECT_TRUE(other_camera != nullptr);
+  Connect(other_engine.GetMessenger(), "camera", 44);
+  EXPECT_TRUE(other_camera->IsConnected());
+  EXPECT_FALSE(camera->IsConnected());
+}
+
+TEST(MalformedMessagesAreIgnored) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16);
+  EXPECT_TRUE(FakeFlutterTizen::SendToCallback(
+      messenger, kChannel, std::vector<uint8_t>(15, 1)));
+  EXPECT_FALSE(stream->IsConnected());
+  // The Dart side is replied to regardless.
+  EXPECT_EQ(1u, messenger->responses.size());
+}
+
+TEST(ChannelIsRemovedWithTheLastStream) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto camera = FlutterExternalDataStream::Create(messenger, "camera", 16);
+  auto sensor = FlutterExternalDataStream::Create(messenger, "sensor", 16);
+  EXPECT_EQ(2, messenger->ref_count);
+  camera.reset();
+  EXPECT_EQ(1u, messenger->callbacks.count(kChannel));
+  sensor.reset();
+  EXPECT_EQ(0u, messenger->callbacks.count(kChannel));
+  EXPECT_EQ(0, messenger->ref_count);
+
+  // A stream of the same name can be created again.
+  camera = FlutterExternalDataStream::Create(messenger, "camera", 16);
+  EXPECT_TRUE(camera != nullptr);
+  EXPECT_EQ(1u, messenger->callbacks.count(kChannel));
+}
+
+TEST(StreamOutlivesEngine) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto stream = FlutterExternalDataStream::Create(messenger, "camera", 16, 1);
+  FakeDartApi::OpenPort(42);
+  Connect(messenger, "camera", 42);
+  uint8_t* buffer = stream->AcquireBuffer();
+  EXPECT_TRUE(stream->Post(buffer, 16));
+
+  // The messenger stays valid until the stream releases it.
+  engine.Shutdown();
+  EXPECT_FALSE(FlutterDesktopMessengerIsAvailable(messenger));
+  EXPECT_EQ(1, messenger->ref_count);
+  stream.reset();
+
+  // The buffer held by Dart outlives the stream.
+  const FakeExternalData& data = FakeDartApi::GetHeldData().back();
+  memset(data.data, 7, data.length);
+  EXPECT_EQ(7, data.data[data.length - 1]);
+  EXPECT_EQ(1u, FakeDartApi::CollectGarbage());
+
+  TestEngine other_engine;
+  auto other_stream = FlutterExternalDataStream::Create(
+      other_engine.GetMessenger(), "camera", 16);
+  EXPECT_TRUE(other_stream != nullptr);
+  EXPECT_EQ(1u, other_engine.GetMessenger()->callbacks.count(kChannel));
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,257 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_frame_stats.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../include/flutter_standard_message.h"
+#include "../tizen_log.h"
+#include "fake/fake_flutter_tizen.h"
+#include "fake/fake_tizen.h"
+#include "testing.h"
+
+namespace {
+
+using Phase = FlutterFrameStats::Phase;
+using Segment = FlutterFrameStats::Segment;
+
+constexpr char kChannel[] = "tizen/frame_timing";
+
+constexpr int64_t kFrameBudgetUs = 16667;
+
+// Records the messages written by the logger.
+class TestLogSink : public TizenLogSink {
+ public:
+  void Write(log_priority priority, const char* tag,
+             const char* message) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    messages_.push_back(message);
+  }
+
+  std::vector<std::string> GetMessages() {
+    TizenLog::Flush();
+    std::lock_guard<std::mutex> lock(mutex_);
+    return messages_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::string> messages_;
+};
+
+// An engine of the fake engine API and the frame stats of it, which log to
+// a |TestLogSink|.
+class TestFrameStats {
+ public:
+  TestFrameStats() {
+    FakeEcore::Reset();
+    auto sink = std::make_unique<TestLogSink>();
+    sink_ = sink.get();
+    TizenLog::SetSink(std::move(sink));
+    FlutterDesktopEngineProperties properties = {};
+    engine_ = FlutterDesktopEngineCreate(properties);
+    stats_ = std::make_unique<FlutterFrameStats>(GetMessenger(),
+                                                 kFrameBudgetUs);
+  }
+
+  ~TestFrameStats() {
+    stats_ = nullptr;
+    FlutterDesktopEngineShutdown(engine_);
+    TizenLog::SetSink(nullptr);
+    FakeEcore::Reset();
+  }
+
+  FlutterDesktopMessengerRef GetMessenger() {
+    return FlutterDesktopEngineGetMessenger(engine_);
+  }
+
+  // Sends |values| as the Dart side does.
+  bool SendTimings(const std::vector<int64_t>& values) {
+    FlutterStandardMessageWriter writer;
+    writer.WriteInt64List(values.data(), values.size());
+    return FakeFlutterTizen::SendToCallback(GetMessenger(), kChannel,
+                                            writer.GetBuffer());
+  }
+
+  // The summaries logged so far.
+  std::vector<std::string> GetSummaries() {
+    std::vector<std::string> summaries;
+    for (const std::string& message : sink_->GetMessages()) {
+      if (message.find(" frames since ") != std::string::npos) {
+        summaries.push_back(message);
+      }
+    }
+    return summaries;
+  }
+
+  FlutterFrameStats* operator->() { return stats_.get(); }
+
+ private:
+  TestLogSink* sink_;
+  FlutterDesktopEngineRef engine_;
+  std::unique_ptr<FlutterFrameStats> stats_;
+};
+
+}  // namespace
+
+TEST(NoFramesHaveZeroPercentiles) {
+  TestFrameStats stats;
+  EXPECT_EQ(0u, stats->GetFrameCount());
+  EXPECT_EQ(0.0, stats->GetPercentile(Phase::kBuild, 50));
+  EXPECT_EQ(0.0, stats->GetPercentile(Phase::kTotal, 99, Segment::kLifetime));
+}
+
+TEST(PercentilesAreRoundedUpToBuckets) {
+  TestFrameStats stats;
+  // Build phases of 0.9 ms to 99.9 ms.
+  for (int i = 1; i <= 100; i++) {
+    stats->AddFrame(i * 1000 - 100, 1000, 2000);
+  }
+  EXPECT_EQ(50.0, stats->GetPercentile(Phase::kBuild, 50));
+  EXPECT_EQ(90.0, stats->GetPercentile(Phase::kBuild, 90));
+  EXPECT_EQ(99.0, stats->GetPercentile(Phase::kBuild, 99));
+  // The bucket of the longest frame is capped at its duration.
+  EXPECT_EQ(99.9, stats->GetPercentile(Phase::kBuild, 100));
+  // Out of range percentiles are clamped, and p0 is the shortest frame.
+  EXPECT_EQ(99.9, stats->GetPercentile(Phase::kBuild, 150));
+  EXPECT_EQ(1.0, stats->GetPercentile(Phase::kBuild, 0));
+  EXPECT_EQ(1.0, stats->GetPercentile(Phase::kBuild, -10));
+}
+
+TEST(PercentileRankRoundsUp) {
+  TestFrameStats stats;
+  stats->AddFrame(1200, 1000, 0);
+  stats->AddFrame(3200, 2000, 0);
+  stats->AddFrame(5200, 2000, 0);
+  // The rank of p34 is 1.02 frames, which needs the second frame.
+  EXPECT_EQ(1.5, stats->GetPercentile(Phase::kBuild, 33));
+  EXPECT_EQ(3.5, stats->GetPercentile(Phase::kBuild, 34));
+  EXPECT_EQ(5.2, stats->GetPercentile(Phase::kBuild, 67));
+  // A duration on a bucket boundary falls into the bucket above it.
+  EXPECT_EQ(1.5, stats->GetPercentile(Phase::kRaster, 33));
+  EXPECT_EQ(0.0, stats->GetPercentile(Phase::kTotal, 100));
+}
+
+TEST(LongAndNegativeDurationsAreCounted) {
+  TestFrameStats stats;
+  // Beyond the range of the histogram.
+  stats->AddFrame(250000, -5, 300000);
+  EXPECT_EQ(250.0, stats->GetPercentile(Phase::kBuild, 50));
+  EXPECT_EQ(300.0, stats->GetPercentile(Phase::kTotal, 50));
+  stats->AddFrame(120000, 0, 0);
+  // Both frames are in the last bucket, so the maximum is reported.
+  EXPECT_EQ(250.0, stats->GetPercentile(Phase::kBuild, 50));
+  // A negative duration counts as zero.
+  EXPECT_EQ(0.0, stats->GetPercentile(Phase::kRaster, 100));
+}
+
+TEST(JankAndVsyncOverrunsAreCounted) {
+  TestFrameStats stats;
+  // Within the budget.
+  stats->AddFrame(kFrameBudgetUs, kFrameBudgetUs, kFrameBudgetUs);
+  EXPECT_EQ(0u, stats->GetJankCount());
+  EXPECT_EQ(0u, stats->GetVsyncOverrunCount());
+  // A slow build or raster phase is janky, and its frame overruns the vsync.
+  stats->AddFrame(kFrameBudgetUs + 1, 1000, kFrameBudgetUs + 1001);
+  stats->AddFrame(1000, kFrameBudgetUs + 1, kFrameBudgetUs + 1001);
+  EXPECT_EQ(2u, stats->GetJankCount());
+  EXPECT_EQ(2u, stats->GetVsyncOverrunCount());
+  // Fast phases which together overrun the vsync are not janky.
+  stats->AddFrame(10000, 10000, 20000);
+  EXPECT_EQ(2u, stats->GetJankCount());
+  EXPECT_EQ(3u, stats->GetVsyncOverrunCount());
+  EXPECT_EQ(4u, stats->GetFrameCount());
+}
+
+TEST(SegmentsAreKeptApart) {
+  TestFrameStats stats;
+  stats->AddFrame(30000, 1000, 31000);
+  stats->AddFrame(30000, 1000, 31000);
+  stats->StartSegment();
+  EXPECT_EQ(0u, stats->GetFrameCount());
+  EXPECT_EQ(0.0, stats->GetPercentile(Phase::kBuild, 50));
+
+  stats->AddFrame(2000, 1000, 3000);
+  EXPECT_EQ(1u, stats->GetFrameCount());
+  EXPECT_EQ(0u, stats->GetJankCount());
+  EXPECT_EQ(2.0, stats->GetPercentile(Phase::kBuild, 99));
+  EXPECT_EQ(3u, stats->GetFrameCount(Segment::kLifetime));
+  EXPECT_EQ(2u, stats->GetJankCount(Segment::kLifetime));
+  EXPECT_EQ(2u, stats->GetVsyncOverrunCount(Segment::kLifetime));
+  EXPECT_EQ(30.0,
+            stats->GetPercentile(Phase::kBuild, 50, Segment::kLifetime));
+}
+
+TEST(TimingsAreReceivedOnChannel) {
+  TestFrameStats stats;
+  EXPECT_TRUE(stats.SendTimings({1200, 800, 2500, 20000, 1000, 21500}));
+  EXPECT_EQ(1u, stats.GetMessenger()->responses.size());
+  EXPECT_EQ(2u, stats->GetFrameCount());
+  EXPECT_EQ(1u, stats->GetJankCount());
+  EXPECT_EQ(1.5, stats->GetPercentile(Phase::kBuild, 50));
+  EXPECT_EQ(1.0, stats->GetPercentile(Phase::kRaster, 50));
+
+  // Incomplete frames and other types are ignored, and still replied to.
+  EXPECT_TRUE(stats.SendTimings({1000, 1000}));
+  FlutterStandardMessageWriter writer;
+  writer.WriteInt(1000);
+  EXPECT_TRUE(FakeFlutterTizen::SendToCallback(stats.GetMessenger(),
+                                               kChannel, writer.GetBuffer()));
+  EXPECT_EQ(3u, stats.GetMessenger()->responses.size());
+  EXPECT_EQ(2u, stats->GetFrameCount());
+}
+
+TEST(SummariesAreLoggedOnlyWithNewFrames) {
+  TestFrameStats stats;
+  stats->SetLogInterval(1.0);
+  EXPECT_EQ(1u, FakeEcore::GetTimerCount());
+  FakeEcore::RunTimers();
+  EXPECT_TRUE(stats.GetSummaries().empty());
+
+  stats->AddFrame(1200, 800, 2500);
+  FakeEcore::RunTimers();
+  std::vector<std::string> summaries = stats.GetSummaries();
+  EXPECT_EQ(1u, summaries.size());
+  if (!summaries.empty()) {
+    EXPECT_EQ(
+        "1 frames since resume: 0 janky, 0 vsync overruns, build "
+        "p50/p90/p99 1.2/1.2/1.2 ms, raster p50/p90/p99 0.8/0.8/0.8 ms.",
+        summaries[0]);
+  }
+  FakeEcore::RunTimers();
+  EXPECT_EQ(1u, stats.GetSummaries().size());
+
+  // A new segment with as many frames as the last summary is still new.
+  stats->StartSegment();
+  stats->AddFrame(1200, 800, 2500);
+  FakeEcore::RunTimers();
+  EXPECT_EQ(2u, stats.GetSummaries().size());
+
+  stats->SetLogInterval(0.0);
+  EXPECT_EQ(0u, FakeEcore::GetTimerCount());
+}
+
+TEST(DestructionStopsLoggingAndReceiving) {
+  FakeEcore::Reset();
+  FlutterDesktopEngineProperties properties = {};
+  FlutterDesktopEngineRef engine = FlutterDesktopEngineCreate(properties);
+  FlutterDesktopMessengerRef messenger =
+      FlutterDesktopEngineGetMessenger(engine);
+  {
+    FlutterFrameStats stats(messenger);
+    stats.SetLogInterval(1.0);
+    EXPECT_EQ(1u, messenger->callbacks.count(kChannel));
+  }
+  EXPECT_EQ(0u, messenger->callbacks.count(kChannel));
+  EXPECT_EQ(0u, FakeEcore::GetTimerCount());
+  FlutterDesktopEngineShutdown(engine);
+}
+
+int main() {
+  return RunAllTests();
+}
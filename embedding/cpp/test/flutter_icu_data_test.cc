@@ -0,0 +1,104 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_icu_data.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "testing.h"
+
+namespace {
+
+// A bundled ICU data file and a shared directory, removed when destroyed.
+class TestFiles {
+ public:
+  TestFiles() {
+    char directory[] = "/tmp/icu_data_test_XXXXXX";
+    directory_ = mkdtemp(directory);
+    bundled_path_ = directory_ + "/icudtl.dat";
+    shared_directory_ = directory_ + "/shared";
+    cache_path_ = directory_ + "/cache";
+    mkdir(shared_directory_.c_str(), 0755);
+    WriteFile(bundled_path_, "bundled ICU data");
+  }
+
+  ~TestFiles() {
+    std::string command = "rm -rf " + directory_;
+    system(command.c_str());
+  }
+
+  // Writes |content| to a shared file named after |checksum| and returns its
+  // path.
+  std::string AddSharedFile(uint64_t checksum, const std::string& content) {
+    char file_name[32];
+    snprintf(file_name, sizeof(file_name), "icudtl-%016" PRIx64 ".dat",
+             checksum);
+    std::string path = shared_directory_ + "/" + file_name;
+    WriteFile(path, content);
+    return path;
+  }
+
+  // Whether a checksum has been computed and cached.
+  bool HasCache() const { return access(cache_path_.c_str(), F_OK) == 0; }
+
+  std::string Resolve() const {
+    return FlutterIcuData::Resolve(bundled_path_, {shared_directory_},
+                                   cache_path_);
+  }
+
+  const std::string& bundled_path() const { return bundled_path_; }
+
+ private:
+  static void WriteFile(const std::string& path, const std::string& content) {
+    FILE* file = fopen(path.c_str(), "w");
+    fputs(content.c_str(), file);
+    fclose(file);
+  }
+
+  std::string directory_;
+  std::string bundled_path_;
+  std::string shared_directory_;
+  std::string cache_path_;
+};
+
+}  // namespace
+
+TEST(ResolveWithoutSharedFileSkipsChecksum) {
+  TestFiles files;
+  EXPECT_EQ(files.bundled_path(), files.Resolve());
+  EXPECT_FALSE(files.HasCache());
+}
+
+TEST(ResolveWithSharedFileOfOtherSizeSkipsChecksum) {
+  TestFiles files;
+  files.AddSharedFile(1, "other ICU data");
+  EXPECT_EQ(files.bundled_path(), files.Resolve());
+  EXPECT_FALSE(files.HasCache());
+}
+
+TEST(ResolveFindsIdenticalSharedFile) {
+  TestFiles files;
+  std::string shared_path = files.AddSharedFile(
+      FlutterIcuData::ComputeChecksum(files.bundled_path()),
+      "bundled ICU data");
+  EXPECT_EQ(shared_path, files.Resolve());
+  EXPECT_TRUE(files.HasCache());
+}
+
+TEST(ResolveRejectsCorruptedSharedFile) {
+  TestFiles files;
+  files.AddSharedFile(FlutterIcuData::ComputeChecksum(files.bundled_path()),
+                      "bundled ICU dat!");
+  EXPECT_EQ(files.bundled_path(), files.Resolve());
+}
+
+int main() {
+  return RunAllTests();
+}
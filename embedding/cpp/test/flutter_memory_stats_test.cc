@@ -0,0 +1,169 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_memory_stats.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "testing.h"
+
+namespace {
+
+constexpr char kPluginDirectory[] = "/opt/usr/globalapps/org.example/lib/";
+
+// An smaps file with a mapping of each category. Only the Pss lines are
+// counted, and a mapping without any Pss line adds nothing.
+constexpr char kSmaps[] =
+    "55d0c0000000-55d0c0021000 rw-p 00000000 00:00 0 [heap]\n"
+    "Size:                132 kB\n"
+    "Rss:                 100 kB\n"
+    "Pss:                 100 kB\n"
+    "Pss_Anon:            100 kB\n"
+    "7f0000000000-7f0000400000 rw-p 00000000 00:00 0 [anon:dart-heap]\n"
+    "Pss:                2000 kB\n"
+    "7f0000400000-7f0000500000 rw-p 00000000 00:00 0 [anon:dart-code]\n"
+    "Pss:                  50 kB\n"
+    "7f0000500000-7f0000600000 rw-p 00000000 00:00 0 [anon:scudo:primary]\n"
+    "Pss:                  30 kB\n"
+    "7f0000600000-7f0000680000 rw-p 00000000 00:00 0 \n"
+    "Pss:                  15 kB\n"
+    "7f0000680000-7f0000700000 rw-p 00000000 00:00 0\n"
+    "Pss:                   5 kB\n"
+    "7f0000700000-7f0000800000 rw-s 00000000 00:06 12 /dev/dri/renderD128\n"
+    "Pss:                 400 kB\n"
+    "7f0000800000-7f0000900000 rw-s 00000000 00:0d 34 anon_inode:dmabuf\n"
+    "Pss:                 300 kB\n"
+    "7f0000900000-7f0000a00000 r-xp 00000000 b3:10 56 "
+    "/opt/usr/globalapps/org.example/lib/libapp.so\n"
+    "Pss:                 600 kB\n"
+    "7f0000a00000-7f0000b00000 r--p 00000000 b3:10 57 "
+    "/opt/usr/globalapps/org.example/res/flutter_assets/icudtl.dat\n"
+    "Pss:                 700 kB\n"
+    "7f0000b00000-7f0000c00000 r-xp 00000000 b3:10 58 "
+    "/usr/lib/libflutter_engine.so\n"
+    "Pss:                 800 kB\n"
+    "7f0000c00000-7f0000d00000 r-xp 00000000 b3:10 59 "
+    "/usr/lib/libflutter_tizen_common.so\n"
+    "Pss:                  80 kB\n"
+    "7f0000d00000-7f0000e00000 r-xp 00000000 b3:10 60 "
+    "/opt/usr/globalapps/org.example/lib/libfoo_plugin.so\n"
+    "Pss:                  90 kB\n"
+    "7f0000e00000-7f0000f00000 r-xp 00000000 b3:10 61 "
+    "/opt/usr/globalapps/org.example/lib/libbar.so.1.2\n"
+    "Pss:                  10 kB\n"
+    "7f0000f00000-7f0001000000 r-xp 00000000 b3:10 62 /usr/lib/libc.so.6\n"
+    "Pss:                 150 kB\n"
+    "7f0001000000-7f0001100000 r--p 00000000 b3:10 63 "
+    "/opt/usr/globalapps/org.example/lib/data file.bin\n"
+    "Pss:                   5 kB\n"
+    "7ffd00000000-7ffd00021000 rw-p 00000000 00:00 0 [stack]\n"
+    "Pss:                  40 kB\n"
+    "SwapPss:              99 kB\n"
+    "7ffd00022000-7ffd00024000 r-xp 00000000 00:00 0 [vdso]\n"
+    "Size:                  8 kB\n";
+
+// A directory holding an smaps file, removed when destroyed.
+class TestProc {
+ public:
+  TestProc() {
+    char directory[] = "/tmp/memory_stats_test_XXXXXX";
+    directory_ = mkdtemp(directory);
+    smaps_path_ = directory_ + "/smaps";
+    FILE* file = fopen(smaps_path_.c_str(), "w");
+    fputs(kSmaps, file);
+    fclose(file);
+  }
+
+  ~TestProc() {
+    remove(smaps_path_.c_str());
+    rmdir(directory_.c_str());
+  }
+
+  const std::string& directory() const { return directory_; }
+  const std::string& smaps_path() const { return smaps_path_; }
+
+ private:
+  std::string directory_;
+  std::string smaps_path_;
+};
+
+int64_t KiB(int64_t value) {
+  return value * 1024;
+}
+
+int64_t GetCategoryTotal(const FlutterMemoryUsage& usage) {
+  return usage.dart_heap + usage.gpu + usage.aot_library + usage.icu_data +
+         usage.engine_library + usage.plugin_libraries + usage.native_heap +
+         usage.other;
+}
+
+}  // namespace
+
+TEST(ReadsFixedSmaps) {
+  TestProc proc;
+  FlutterMemoryUsage usage;
+  EXPECT_TRUE(FlutterMemoryStats::ReadSmaps(proc.smaps_path(),
+                                            kPluginDirectory, usage));
+  EXPECT_EQ(KiB(2050), usage.dart_heap);
+  EXPECT_EQ(KiB(700), usage.gpu);
+  EXPECT_EQ(KiB(600), usage.aot_library);
+  EXPECT_EQ(KiB(700), usage.icu_data);
+  EXPECT_EQ(KiB(880), usage.engine_library);
+  EXPECT_EQ(KiB(100), usage.plugin_libraries);
+  EXPECT_EQ(KiB(150), usage.native_heap);
+  EXPECT_EQ(KiB(195), usage.other);
+  EXPECT_EQ(KiB(5375), usage.total);
+  EXPECT_EQ(usage.total, GetCategoryTotal(usage));
+  EXPECT_EQ(-1, usage.image_cache);
+}
+
+TEST(PluginLibrariesNeedAPluginDirectory) {
+  TestProc proc;
+  FlutterMemoryUsage usage;
+  EXPECT_TRUE(FlutterMemoryStats::ReadSmaps(proc.smaps_path(), "", usage));
+  EXPECT_EQ(0, usage.plugin_libraries);
+  EXPECT_EQ(KiB(295), usage.other);
+  EXPECT_EQ(KiB(5375), usage.total);
+}
+
+TEST(ReadsOwnSmaps) {
+  FlutterMemoryUsage usage;
+  EXPECT_TRUE(FlutterMemoryStats::ReadSmaps("/proc/self/smaps", "", usage));
+  EXPECT_TRUE(usage.total > 0);
+  EXPECT_TRUE(usage.native_heap > 0);
+  EXPECT_EQ(usage.total, GetCategoryTotal(usage));
+}
+
+TEST(MissingSmapsIsAnError) {
+  FlutterMemoryUsage usage;
+  EXPECT_FALSE(
+      FlutterMemoryStats::ReadSmaps("/nonexistent/smaps", "", usage));
+  EXPECT_EQ(0, usage.total);
+}
+
+TEST(RecordKeepsTheLatestSamples) {
+  TestProc proc;
+  FlutterMemoryStats stats(nullptr, 2, proc.directory());
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(KiB(5375), stats.Record().total);
+  }
+  EXPECT_EQ(2u, stats.GetTimeSeries().size());
+  std::string exported = stats.ExportTimeSeries();
+  // A header line and a line per sample.
+  size_t line_count = 0;
+  for (char c : exported) {
+    line_count += c == '\n';
+  }
+  EXPECT_EQ(3u, line_count);
+  EXPECT_TRUE(exported.find(" 5375 2050 700 600 700 880 ") !=
+              std::string::npos);
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,142 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_page_cache.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+constexpr size_t kPageCount = 8;
+
+// A file of |kPageCount| pages whose residency is controlled by the test.
+//
+// The file is created in the working directory, since pages of files on a
+// tmpfs cannot be evicted.
+class TestFile {
+ public:
+  TestFile() : page_size_(sysconf(_SC_PAGESIZE)) {
+    char directory[] = "page_cache_test_XXXXXX";
+    directory_ = mkdtemp(directory);
+    path_ = directory_ + "/file";
+    profile_path_ = directory_ + "/profile";
+    std::vector<char> data(page_size_ * kPageCount, 1);
+    int fd = open(path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    write(fd, data.data(), data.size());
+    fsync(fd);
+    close(fd);
+  }
+
+  ~TestFile() {
+    remove(path_.c_str());
+    remove(profile_path_.c_str());
+    rmdir(directory_.c_str());
+  }
+
+  // Evicts all pages and makes only |pages| resident.
+  void SetResidentPages(const std::vector<size_t> &pages) {
+    int fd = open(path_.c_str(), O_RDONLY);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    // Prevent the kernel from reading neighboring pages ahead.
+    posix_fadvise(fd, 0, 0, POSIX_FADV_RANDOM);
+    char byte;
+    for (size_t page : pages) {
+      pread(fd, &byte, 1, page * page_size_);
+    }
+    close(fd);
+  }
+
+  const std::string &path() const { return path_; }
+  const std::string &profile_path() const { return profile_path_; }
+
+ private:
+  size_t page_size_;
+  std::string directory_;
+  std::string path_;
+  std::string profile_path_;
+};
+
+}  // namespace
+
+TEST(RecordAddsResidentPages) {
+  TestFile file;
+  file.SetResidentPages({0, 1, 5});
+  FlutterPageCache::RecordingStats stats;
+  EXPECT_TRUE(FlutterPageCache(file.profile_path()).Record({file.path()},
+                                                           &stats));
+  EXPECT_EQ(3u, stats.resident_pages);
+  EXPECT_EQ(0u, stats.profiled_pages);
+
+  file.SetResidentPages({});
+  FlutterPageCache page_cache(file.profile_path());
+  EXPECT_TRUE(page_cache.StartWarming(2));
+  FlutterPageCache::WarmingStats warming_stats = page_cache.WaitForWarming();
+  EXPECT_EQ(3u, warming_stats.profiled_pages);
+  EXPECT_EQ(0u, warming_stats.cached_pages);
+}
+
+TEST(WarmingIsSkippedToRecord) {
+  TestFile file;
+  FlutterPageCache page_cache(file.profile_path());
+  EXPECT_FALSE(page_cache.StartWarming());
+
+  file.SetResidentPages({0});
+  FlutterPageCache(file.profile_path()).Record({file.path()});
+  for (size_t i = 1; i < FlutterPageCache::kRecordingInterval; i++) {
+    FlutterPageCache warmed(file.profile_path());
+    EXPECT_TRUE(warmed.StartWarming());
+  }
+  FlutterPageCache recorded(file.profile_path());
+  EXPECT_FALSE(recorded.StartWarming());
+
+  // Recording starts counting again.
+  FlutterPageCache(file.profile_path()).Record({file.path()});
+  FlutterPageCache warmed(file.profile_path());
+  EXPECT_TRUE(warmed.StartWarming());
+}
+
+TEST(RecordRemovesUnusedPages) {
+  TestFile file;
+  file.SetResidentPages({0, 1, 5});
+  FlutterPageCache(file.profile_path()).Record({file.path()});
+
+  FlutterPageCache::RecordingStats stats;
+  for (uint32_t i = 1; i < FlutterPageCache::kMaxPageAge; i++) {
+    file.SetResidentPages({0, 2});
+    FlutterPageCache(file.profile_path()).Record({file.path()}, &stats);
+    EXPECT_EQ(0u, stats.removed_pages);
+  }
+  EXPECT_EQ(2u, stats.resident_pages);
+  EXPECT_EQ(2u, stats.profiled_pages);
+
+  file.SetResidentPages({0});
+  FlutterPageCache(file.profile_path()).Record({file.path()}, &stats);
+  EXPECT_EQ(2u, stats.removed_pages);
+
+  FlutterPageCache page_cache(file.profile_path());
+  EXPECT_TRUE(page_cache.StartWarming());
+  EXPECT_EQ(2u, page_cache.WaitForWarming().profiled_pages);
+}
+
+TEST(ChangedFileIsNotWarmed) {
+  TestFile file;
+  file.SetResidentPages({0});
+  FlutterPageCache(file.profile_path()).Record({file.path()});
+  truncate(file.path().c_str(), 1);
+
+  FlutterPageCache page_cache(file.profile_path());
+  EXPECT_FALSE(page_cache.StartWarming());
+}
+
+int main() {
+  return RunAllTests();
+}
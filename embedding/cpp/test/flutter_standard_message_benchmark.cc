@@ -0,0 +1,118 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the cost of writing and reading typical standard codec messages
+// with FlutterStandardMessageWriter and FlutterStandardMessageReader.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../include/flutter_standard_message.h"
+
+namespace {
+
+// The time spent on each benchmark.
+constexpr std::chrono::milliseconds kDuration(500);
+
+// Keeps the compiler from dropping the work of a benchmark.
+volatile uint64_t g_sink = 0;
+
+// Runs |body| repeatedly for |kDuration|, and prints the mean time per call
+// and the throughput of |bytes_per_call|.
+template <typename Body>
+void Run(const char* name, size_t bytes_per_call, Body body) {
+  size_t calls = 0;
+  auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::duration::zero();
+  while (elapsed < kDuration) {
+    for (int i = 0; i < 100; i++) {
+      body();
+    }
+    calls += 100;
+    elapsed = std::chrono::steady_clock::now() - start;
+  }
+  double seconds = std::chrono::duration<double>(elapsed).count();
+  printf("  %-28s %10.1f ns/call %12.1f MB/s\n", name, seconds * 1e9 / calls,
+         bytes_per_call * calls / seconds / 1e6);
+}
+
+// Writes a map like the arguments of a typical method call.
+void WriteArguments(FlutterStandardMessageWriter& writer) {
+  writer.BeginMap(6);
+  writer.WriteString("id");
+  writer.WriteInt(42);
+  writer.WriteString("timestamp");
+  writer.WriteInt(int64_t{1} << 40);
+  writer.WriteString("name");
+  writer.WriteString("flutter_standard_message_benchmark");
+  writer.WriteString("scale");
+  writer.WriteDouble(1.5);
+  writer.WriteString("enabled");
+  writer.WriteBool(true);
+  writer.WriteString("tags");
+  writer.BeginList(3);
+  writer.WriteString("a");
+  writer.WriteString("b");
+  writer.WriteString("c");
+}
+
+// Reads every value of |message| and returns a checksum of them.
+uint64_t ReadAll(const std::vector<uint8_t>& message) {
+  FlutterStandardMessageReader reader(message.data(), message.size());
+  FlutterStandardValue value;
+  uint64_t checksum = 0;
+  while (reader.Read(value)) {
+    checksum += value.int_value + value.length;
+    if (const double* elements = value.AsTypedList<double>()) {
+      checksum += static_cast<uint64_t>(elements[value.length / 2]);
+    }
+  }
+  return checksum;
+}
+
+}  // namespace
+
+int main() {
+  std::vector<uint8_t> arguments;
+  {
+    FlutterStandardMessageWriter writer;
+    WriteArguments(writer);
+    arguments = writer.TakeBuffer();
+  }
+
+  // A batch of samples, as streamed by a sensor plugin.
+  std::vector<double> samples(4096);
+  for (size_t i = 0; i < samples.size(); i++) {
+    samples[i] = i * 0.5;
+  }
+  std::vector<uint8_t> batch;
+  {
+    FlutterStandardMessageWriter writer;
+    writer.WriteFloat64List(samples.data(), samples.size());
+    batch = writer.TakeBuffer();
+  }
+
+  printf("Standard message codec (%zu byte arguments, %zu byte batch):\n",
+         arguments.size(), batch.size());
+  Run("Write arguments", arguments.size(), [&]() {
+    FlutterStandardMessageWriter writer(arguments.size());
+    WriteArguments(writer);
+    g_sink += writer.GetBuffer().size();
+  });
+  Run("Read arguments", arguments.size(),
+      [&]() { g_sink += ReadAll(arguments); });
+  Run("Skip arguments", arguments.size(), [&]() {
+    FlutterStandardMessageReader reader(arguments.data(), arguments.size());
+    g_sink += reader.Skip();
+  });
+  Run("Write batch", batch.size(), [&]() {
+    FlutterStandardMessageWriter writer(batch.size());
+    writer.WriteFloat64List(samples.data(), samples.size());
+    g_sink += writer.GetBuffer().size();
+  });
+  Run("Read batch", batch.size(), [&]() { g_sink += ReadAll(batch); });
+  return 0;
+}
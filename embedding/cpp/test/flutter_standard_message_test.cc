@@ -0,0 +1,360 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_standard_message.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+// StandardMessageCodec.encodeMessage(<Object?>[null, true, false, 1,
+// 1 << 32, 'hey', 3.5]) of package:flutter/services.dart.
+const std::vector<uint8_t> kStockList = {
+    0x0c, 0x07,                                            // List of 7
+    0x00,                                                  // null
+    0x01,                                                  // true
+    0x02,                                                  // false
+    0x03, 0x01, 0x00, 0x00, 0x00,                          // 1
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,  // 1 << 32
+    0x07, 0x03, 'h',  'e',  'y',                           // 'hey'
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,        // 3.5, aligned
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x40,        // to 8 bytes
+};
+
+// StandardMessageCodec.encodeMessage(<Object?, Object?>{'a': <Object?>[
+// Int32List.fromList([1, 2])], 'b': <Object?, Object?>{}}).
+const std::vector<uint8_t> kStockMap = {
+    0x0d, 0x02,                    // Map of 2
+    0x07, 0x01, 'a',               // 'a'
+    0x0c, 0x01,                    // List of 1
+    0x09, 0x02, 0x00, 0x00, 0x00,  // Int32List of 2, aligned to 4 bytes
+    0x01, 0x00, 0x00, 0x00,        //
+    0x02, 0x00, 0x00, 0x00,        //
+    0x07, 0x01, 'b',               // 'b'
+    0x0d, 0x00,                    // Map of 0
+};
+
+// A copy of a message at |offset| bytes past an 8 byte boundary.
+class MessageBuffer {
+ public:
+  explicit MessageBuffer(const std::vector<uint8_t>& message,
+                         size_t offset = 0)
+      : storage_((message.size() + offset) / sizeof(uint64_t) + 1),
+        size_(message.size()) {
+    data_ = reinterpret_cast<uint8_t*>(storage_.data()) + offset;
+    memcpy(data_, message.data(), message.size());
+  }
+
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  std::vector<uint64_t> storage_;
+  uint8_t* data_;
+  size_t size_;
+};
+
+// Whether the whole of |message| is one well-formed value.
+bool IsWellFormed(const uint8_t* data, size_t size) {
+  FlutterStandardMessageReader reader(data, size);
+  return reader.Skip() && reader.IsAtEnd() && !reader.HasError();
+}
+
+}  // namespace
+
+TEST(ReadsStockList) {
+  FlutterStandardMessageReader reader(kStockList.data(), kStockList.size());
+  FlutterStandardValue value;
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kList);
+  EXPECT_EQ(7u, value.length);
+
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kNull);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kTrue);
+  EXPECT_EQ(1, value.int_value);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kFalse);
+  EXPECT_EQ(0, value.int_value);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kInt32);
+  EXPECT_EQ(1, value.int_value);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kInt64);
+  EXPECT_EQ(int64_t{1} << 32, value.int_value);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kString);
+  EXPECT_EQ("hey", value.AsString());
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kFloat64);
+  EXPECT_EQ(3.5, value.double_value);
+
+  EXPECT_TRUE(reader.IsAtEnd());
+  EXPECT_FALSE(reader.Read(value));
+  EXPECT_FALSE(reader.HasError());
+}
+
+TEST(WritesStockEncoding) {
+  FlutterStandardMessageWriter list_writer;
+  list_writer.BeginList(7);
+  list_writer.WriteNull();
+  list_writer.WriteBool(true);
+  list_writer.WriteBool(false);
+  list_writer.WriteInt(1);
+  list_writer.WriteInt(int64_t{1} << 32);
+  list_writer.WriteString("hey");
+  list_writer.WriteDouble(3.5);
+  EXPECT_TRUE(kStockList == list_writer.GetBuffer());
+
+  const int32_t elements[] = {1, 2};
+  FlutterStandardMessageWriter map_writer;
+  map_writer.BeginMap(2);
+  map_writer.WriteString("a");
+  map_writer.BeginList(1);
+  map_writer.WriteInt32List(elements, 2);
+  map_writer.WriteString("b");
+  map_writer.BeginMap(0);
+  EXPECT_TRUE(kStockMap == map_writer.GetBuffer());
+}
+
+TEST(ReadsNestedListsAndMaps) {
+  MessageBuffer buffer(kStockMap);
+  FlutterStandardMessageReader reader(buffer.data(), buffer.size());
+  FlutterStandardValue value;
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kMap);
+  EXPECT_EQ(2u, value.length);
+
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ("a", value.AsString());
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kList);
+  EXPECT_EQ(1u, value.length);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kInt32List);
+  EXPECT_EQ(2u, value.length);
+  const int32_t* elements = value.AsTypedList<int32_t>();
+  EXPECT_TRUE(elements != nullptr);
+  if (elements) {
+    EXPECT_EQ(1, elements[0]);
+    EXPECT_EQ(2, elements[1]);
+  }
+
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ("b", value.AsString());
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kMap);
+  EXPECT_EQ(0u, value.length);
+  EXPECT_TRUE(reader.IsAtEnd());
+
+  // Skipping a key steps over the whole of its value.
+  FlutterStandardMessageReader skipping_reader(buffer.data(), buffer.size());
+  EXPECT_TRUE(skipping_reader.Read(value));
+  EXPECT_TRUE(skipping_reader.Skip());
+  EXPECT_TRUE(skipping_reader.Skip());
+  EXPECT_TRUE(skipping_reader.Read(value));
+  EXPECT_EQ("b", value.AsString());
+}
+
+TEST(RoundTripsAllTypes) {
+  const uint8_t bytes[] = {1, 2, 3};
+  const int32_t int32s[] = {-1, 0, 1};
+  const int64_t int64s[] = {int64_t{1} << 40};
+  const float float32s[] = {0.5f, -2.0f};
+  const double float64s[] = {1.25, -0.0, 1e300};
+  const std::string long_string(300, 'x');
+
+  FlutterStandardMessageWriter writer;
+  writer.BeginMap(2);
+  writer.WriteString("values");
+  writer.BeginList(10);
+  writer.WriteInt(-(int64_t{1} << 40));
+  writer.WriteDouble(-1.5);
+  writer.WriteString(long_string);
+  writer.WriteUint8List(bytes, 3);
+  writer.WriteInt32List(int32s, 3);
+  writer.WriteInt64List(int64s, 1);
+  writer.WriteFloat32List(float32s, 2);
+  writer.WriteFloat64List(float64s, 3);
+  writer.WriteString("");
+  writer.WriteUint8List(nullptr, 0);
+  writer.WriteInt(7);
+  writer.WriteNull();
+  std::vector<uint8_t> message = writer.TakeBuffer();
+  EXPECT_TRUE(writer.GetBuffer().empty());
+
+  MessageBuffer buffer(message);
+  EXPECT_TRUE(IsWellFormed(buffer.data(), buffer.size()));
+
+  FlutterStandardMessageReader reader(buffer.data(), buffer.size());
+  FlutterStandardValue value;
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ("values", value.AsString());
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ(10u, value.length);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ(-(int64_t{1} << 40), value.int_value);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ(-1.5, value.double_value);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ(long_string, value.AsString());
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kUint8List);
+  EXPECT_EQ(0, memcmp(bytes, value.AsTypedList<uint8_t>(), sizeof(bytes)));
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kInt32List);
+  EXPECT_EQ(0, memcmp(int32s, value.AsTypedList<int32_t>(), sizeof(int32s)));
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kInt64List);
+  EXPECT_EQ(0, memcmp(int64s, value.AsTypedList<int64_t>(), sizeof(int64s)));
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kFloat32List);
+  EXPECT_EQ(0,
+            memcmp(float32s, value.AsTypedList<float>(), sizeof(float32s)));
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kFloat64List);
+  EXPECT_EQ(0,
+            memcmp(float64s, value.AsTypedList<double>(), sizeof(float64s)));
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kString);
+  EXPECT_EQ(0u, value.length);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kUint8List);
+  EXPECT_EQ(0u, value.length);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ(7, value.int_value);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_TRUE(value.type == FlutterStandardType::kNull);
+  EXPECT_TRUE(reader.IsAtEnd());
+  EXPECT_FALSE(reader.HasError());
+}
+
+TEST(WritesWideSizes) {
+  FlutterStandardMessageWriter writer;
+  writer.WriteString(std::string(253, 'x'));
+  writer.WriteString(std::string(254, 'x'));
+  writer.WriteString(std::string(70000, 'x'));
+  const std::vector<uint8_t>& message = writer.GetBuffer();
+
+  // 253 fits in one byte, 254 takes a uint16 and 70000 a uint32.
+  size_t offset = 0;
+  EXPECT_EQ(253, message[offset + 1]);
+  offset += 2 + 253;
+  EXPECT_EQ(254, message[offset + 1]);
+  EXPECT_EQ(254, message[offset + 2]);
+  EXPECT_EQ(0, message[offset + 3]);
+  offset += 4 + 254;
+  EXPECT_EQ(255, message[offset + 1]);
+  uint32_t size;
+  memcpy(&size, &message[offset + 2], sizeof(size));
+  EXPECT_EQ(70000u, size);
+
+  FlutterStandardMessageReader reader(message.data(), message.size());
+  FlutterStandardValue value;
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ(253u, value.length);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ(254u, value.length);
+  EXPECT_TRUE(reader.Read(value));
+  EXPECT_EQ(70000u, value.length);
+  EXPECT_TRUE(reader.IsAtEnd());
+}
+
+TEST(TruncatedMessagesAreMalformed) {
+  for (const std::vector<uint8_t>* message : {&kStockList, &kStockMap}) {
+    for (size_t size = 1; size < message->size(); size++) {
+      FlutterStandardMessageReader reader(message->data(), size);
+      EXPECT_FALSE(reader.Skip());
+      EXPECT_TRUE(reader.HasError());
+    }
+    EXPECT_TRUE(IsWellFormed(message->data(), message->size()));
+  }
+
+  // An empty message has no values, but is not malformed.
+  FlutterStandardMessageReader reader(kStockList.data(), 0);
+  FlutterStandardValue value;
+  EXPECT_FALSE(reader.Read(value));
+  EXPECT_FALSE(reader.HasError());
+}
+
+TEST(OversizedLengthsAreMalformed) {
+  const std::vector<std::vector<uint8_t>> messages = {
+      // A string of 2^32 - 1 bytes.
+      {0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 'x'},
+      // A string of 65535 bytes.
+      {0x07, 0xfe, 0xff, 0xff, 'x'},
+      // A Float64List whose size in bytes overflows 32 bits.
+      {0x0b, 0xff, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00},
+      // A list of 3 elements with room for 2.
+      {0x0c, 0x03, 0x00, 0x00},
+      // A map of 2 entries with room for 1.
+      {0x0d, 0x02, 0x00, 0x00, 0x00},
+      // An unknown type.
+      {0x0f},
+  };
+  for (const std::vector<uint8_t>& message : messages) {
+    FlutterStandardMessageReader reader(message.data(), message.size());
+    FlutterStandardValue value;
+    EXPECT_FALSE(reader.Read(value));
+    EXPECT_TRUE(reader.HasError());
+    // Nothing can be read after an error.
+    EXPECT_FALSE(reader.Read(value));
+  }
+}
+
+TEST(DeeplyNestedListsAreSkipped) {
+  constexpr size_t kDepth = 100000;
+  FlutterStandardMessageWriter writer;
+  for (size_t i = 0; i < kDepth; i++) {
+    writer.BeginList(1);
+  }
+  writer.WriteNull();
+  const std::vector<uint8_t>& message = writer.GetBuffer();
+  EXPECT_TRUE(IsWellFormed(message.data(), message.size()));
+}
+
+TEST(TypedListsAreAlignedToTheMessage) {
+  const double elements[] = {1.0, 2.0};
+  FlutterStandardMessageWriter writer;
+  writer.WriteString("a");
+  writer.WriteFloat64List(elements, 2);
+  const std::vector<uint8_t>& message = writer.GetBuffer();
+  // The type and size of the list are followed by padding up to 8 bytes.
+  EXPECT_EQ(8u + sizeof(elements), message.size());
+
+  for (size_t offset = 0; offset < 8; offset++) {
+    MessageBuffer buffer(message, offset);
+    FlutterStandardMessageReader reader(buffer.data(), buffer.size());
+    FlutterStandardValue value;
+    EXPECT_TRUE(reader.Read(value));
+    EXPECT_TRUE(reader.Read(value));
+    EXPECT_EQ(2u, value.length);
+    EXPECT_TRUE(value.data == buffer.data() + 8);
+
+    const double* aligned_elements = value.AsTypedList<double>();
+    if (offset == 0) {
+      EXPECT_TRUE(aligned_elements != nullptr);
+      if (aligned_elements) {
+        EXPECT_EQ(2.0, aligned_elements[1]);
+      }
+    } else {
+      // The elements of a misaligned message must be copied out instead.
+      EXPECT_TRUE(aligned_elements == nullptr);
+      double copied_elements[2];
+      memcpy(copied_elements, value.data, sizeof(copied_elements));
+      EXPECT_EQ(2.0, copied_elements[1]);
+    }
+    EXPECT_TRUE(value.AsTypedList<uint8_t>() != nullptr);
+  }
+}
+
+int main() {
+  return RunAllTests();
+}
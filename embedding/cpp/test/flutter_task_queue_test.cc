@@ -0,0 +1,307 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_task_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fake/fake_flutter_tizen.h"
+#include "fake/fake_tizen.h"
+#include "testing.h"
+
+namespace {
+
+constexpr char kChannel[] = "tizen/background";
+
+// How long to wait for the background threads before failing.
+constexpr std::chrono::seconds kTimeout(10);
+
+// Lets threads wait until it is opened.
+class Gate {
+ public:
+  void Open() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_open_ = true;
+    cv_.notify_all();
+  }
+
+  bool Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, kTimeout, [this]() { return is_open_; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool is_open_ = false;
+};
+
+// Counts up and lets threads wait for a count.
+class Counter {
+ public:
+  void Increment() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    count_++;
+    cv_.notify_all();
+  }
+
+  bool WaitFor(int count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, kTimeout,
+                        [this, count]() { return count_ >= count; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  int count_ = 0;
+};
+
+// An engine of the fake engine API, shut down when destroyed unless
+// |Shutdown| has been called.
+class TestEngine {
+ public:
+  TestEngine() {
+    FlutterDesktopEngineProperties properties = {};
+    engine_ = FlutterDesktopEngineCreate(properties);
+  }
+
+  ~TestEngine() { Shutdown(); }
+
+  void Shutdown() {
+    if (engine_) {
+      FlutterDesktopEngineShutdown(engine_);
+      engine_ = nullptr;
+    }
+  }
+
+  FlutterDesktopMessengerRef GetMessenger() {
+    return FlutterDesktopEngineGetMessenger(engine_);
+  }
+
+ private:
+  FlutterDesktopEngineRef engine_ = nullptr;
+};
+
+std::vector<uint8_t> ToBytes(const std::string& value) {
+  return std::vector<uint8_t>(value.begin(), value.end());
+}
+
+std::vector<std::string> GetResponses(FlutterDesktopMessengerRef messenger) {
+  std::vector<std::string> responses;
+  for (const std::vector<uint8_t>& response : messenger->responses) {
+    responses.emplace_back(response.begin(), response.end());
+  }
+  return responses;
+}
+
+}  // namespace
+
+TEST(ThreadCountDependsOnType) {
+  EXPECT_EQ(1u, FlutterTaskQueue(FlutterTaskQueue::Type::kSerial, 4)
+                    .GetThreadCount());
+  EXPECT_EQ(3u, FlutterTaskQueue(FlutterTaskQueue::Type::kConcurrent, 3)
+                    .GetThreadCount());
+  EXPECT_TRUE(FlutterTaskQueue(FlutterTaskQueue::Type::kConcurrent)
+                  .GetThreadCount() >= 1);
+}
+
+TEST(SerialQueueRunsTasksInOrder) {
+  FlutterTaskQueue queue;
+  std::vector<int> order;
+  std::atomic<int> running{0};
+  std::atomic<int> max_running{0};
+  Counter done;
+  for (int i = 0; i < 100; i++) {
+    queue.Post([&, i]() {
+      int now_running = ++running;
+      if (now_running > max_running) {
+        max_running = now_running;
+      }
+      order.push_back(i);
+      running--;
+      done.Increment();
+    });
+  }
+  EXPECT_TRUE(done.WaitFor(100));
+  EXPECT_EQ(1, max_running.load());
+  bool is_in_order = order.size() == 100;
+  for (size_t i = 0; is_in_order && i < order.size(); i++) {
+    is_in_order = order[i] == static_cast<int>(i);
+  }
+  EXPECT_TRUE(is_in_order);
+}
+
+TEST(ConcurrentQueueRunsTasksInParallel) {
+  constexpr int kThreadCount = 4;
+  FlutterTaskQueue queue(FlutterTaskQueue::Type::kConcurrent, kThreadCount);
+  // Each task waits for all the others to start, which only finishes if
+  // they run at the same time.
+  Counter started;
+  Counter finished;
+  for (int i = 0; i < kThreadCount; i++) {
+    queue.Post([&]() {
+      started.Increment();
+      if (started.WaitFor(kThreadCount)) {
+        finished.Increment();
+      }
+    });
+  }
+  EXPECT_TRUE(finished.WaitFor(kThreadCount));
+}
+
+TEST(DestructionDiscardsPendingTasks) {
+  auto queue = std::make_unique<FlutterTaskQueue>();
+  Gate running;
+  Gate release;
+  std::atomic<bool> is_running_task_done{false};
+  std::atomic<int> pending_run{0};
+  queue->Post([&]() {
+    running.Open();
+    release.Wait();
+    is_running_task_done = true;
+  });
+  // Expires once the pending tasks are discarded.
+  auto token = std::make_shared<int>(0);
+  std::weak_ptr<int> weak_token = token;
+  for (int i = 0; i < 10; i++) {
+    queue->Post([&pending_run, token]() { pending_run++; });
+  }
+  token = nullptr;
+  EXPECT_TRUE(running.Wait());
+
+  // The running task is only let go once the destructor has discarded the
+  // pending tasks.
+  std::thread releaser([&]() {
+    auto deadline = std::chrono::steady_clock::now() + kTimeout;
+    while (!weak_token.expired() &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    release.Open();
+  });
+  queue = nullptr;
+  releaser.join();
+  EXPECT_TRUE(is_running_task_done);
+  EXPECT_EQ(0, pending_run.load());
+}
+
+TEST(BackgroundChannelRepliesOnPlatformThread) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  auto queue = std::make_shared<FlutterTaskQueue>();
+  std::thread::id handler_thread;
+  FlutterBackgroundChannel channel(
+      messenger, kChannel, queue,
+      [&](const uint8_t* message, size_t message_size,
+          FlutterBackgroundChannel::Reply reply) {
+        handler_thread = std::this_thread::get_id();
+        std::vector<uint8_t> result = ToBytes("reply to ");
+        result.insert(result.end(), message, message + message_size);
+        reply(result.data(), result.size());
+      });
+  EXPECT_TRUE(
+      FakeFlutterTizen::SendToCallback(messenger, kChannel, ToBytes("a")));
+  EXPECT_EQ(1u, FakeEcore::RunAsyncCalls(1));
+  EXPECT_TRUE(handler_thread != std::this_thread::get_id());
+  std::vector<std::string> expected = {"reply to a"};
+  EXPECT_TRUE(expected == GetResponses(messenger));
+}
+
+TEST(BackgroundChannelKeepsMessageOrder) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  FlutterBackgroundChannel channel(
+      messenger, kChannel, std::make_shared<FlutterTaskQueue>(),
+      [](const uint8_t* message, size_t message_size,
+         FlutterBackgroundChannel::Reply reply) {
+        reply(message, message_size);
+      });
+  std::vector<std::string> expected;
+  for (int i = 0; i < 20; i++) {
+    expected.push_back(std::to_string(i));
+    FakeFlutterTizen::SendToCallback(messenger, kChannel,
+                                     ToBytes(expected.back()));
+  }
+  size_t replied = 0;
+  while (replied < expected.size()) {
+    size_t count = FakeEcore::RunAsyncCalls(1);
+    if (count == 0) {
+      break;
+    }
+    replied += count;
+  }
+  EXPECT_TRUE(expected == GetResponses(messenger));
+}
+
+TEST(DroppedReplySendsEmptyReply) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  FlutterBackgroundChannel channel(
+      messenger, kChannel, std::make_shared<FlutterTaskQueue>(),
+      [](const uint8_t* message, size_t message_size,
+         FlutterBackgroundChannel::Reply reply) {});
+  FakeFlutterTizen::SendToCallback(messenger, kChannel, ToBytes("a"));
+  EXPECT_EQ(1u, FakeEcore::RunAsyncCalls(1));
+  std::vector<std::string> expected = {""};
+  EXPECT_TRUE(expected == GetResponses(messenger));
+}
+
+TEST(SecondReplyIsIgnored) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  Counter handled;
+  FlutterBackgroundChannel channel(
+      messenger, kChannel, std::make_shared<FlutterTaskQueue>(),
+      [&](const uint8_t* message, size_t message_size,
+          FlutterBackgroundChannel::Reply reply) {
+        reply(message, message_size);
+        reply(message, message_size);
+        handled.Increment();
+      });
+  FakeFlutterTizen::SendToCallback(messenger, kChannel, ToBytes("a"));
+  EXPECT_TRUE(handled.WaitFor(1));
+  EXPECT_EQ(1u, FakeEcore::RunAsyncCalls(1));
+  EXPECT_EQ(1u, messenger->responses.size());
+}
+
+TEST(ReplyAfterShutdownIsDropped) {
+  TestEngine engine;
+  FlutterDesktopMessengerRef messenger = engine.GetMessenger();
+  Gate release;
+  auto queue = std::make_shared<FlutterTaskQueue>();
+  auto channel = std::make_unique<FlutterBackgroundChannel>(
+      messenger, kChannel, queue,
+      [&](const uint8_t* message, size_t message_size,
+          FlutterBackgroundChannel::Reply reply) {
+        release.Wait();
+        reply(message, message_size);
+      });
+  FakeFlutterTizen::SendToCallback(messenger, kChannel, ToBytes("a"));
+
+  // Messages already posted are still handled after the channel is gone.
+  channel = nullptr;
+  EXPECT_EQ(0u, messenger->callbacks.count(kChannel));
+  // Keep the messenger for checking it after the engine is shut down.
+  FlutterDesktopMessengerAddRef(messenger);
+  engine.Shutdown();
+  release.Open();
+  EXPECT_EQ(1u, FakeEcore::RunAsyncCalls(1));
+  EXPECT_TRUE(messenger->responses.empty());
+  // Wait for the handler to let go of its reference.
+  queue = nullptr;
+  EXPECT_EQ(1, messenger->ref_count);
+  FlutterDesktopMessengerRelease(messenger);
+}
+
+int main() {
+  return RunAllTests();
+}
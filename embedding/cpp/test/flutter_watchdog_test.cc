@@ -0,0 +1,111 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_watchdog.h"
+
+#include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+// Keeps the calling thread busy for |milliseconds|.
+void Spin(int milliseconds) {
+  auto end = std::chrono::steady_clock::now() +
+             std::chrono::milliseconds(milliseconds);
+  while (std::chrono::steady_clock::now() < end) {
+  }
+}
+
+// Sends SIGUSR2 to the main thread as the watchdog does for the request
+// numbered |request|.
+void SendStackSignal(int request) {
+  pid_t pid = getpid();
+  siginfo_t info = {};
+  info.si_signo = SIGUSR2;
+  info.si_code = SI_QUEUE;
+  info.si_pid = pid;
+  info.si_uid = getuid();
+  info.si_value.sival_int = request;
+  syscall(SYS_rt_tgsigqueueinfo, pid, pid, SIGUSR2, &info);
+}
+
+// The SIGUSR2 signals received by the handler of the app.
+volatile sig_atomic_t g_app_signal_count = 0;
+
+void OnAppSignal(int signal) {
+  g_app_signal_count = g_app_signal_count + 1;
+}
+
+}  // namespace
+
+// Must run before any other test starts a watchdog, which installs its
+// signal handler only once.
+TEST(OtherSignalsArePassedOnToAppHandler) {
+  struct sigaction action = {};
+  action.sa_handler = OnAppSignal;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGUSR2, &action, nullptr);
+
+  FlutterWatchdog watchdog(0.2, true);
+  EXPECT_TRUE(watchdog.Start());
+  raise(SIGUSR2);
+  EXPECT_EQ(1, static_cast<int>(g_app_signal_count));
+  // A request the watchdog has never made is not its own.
+  SendStackSignal(12345);
+  EXPECT_EQ(2, static_cast<int>(g_app_signal_count));
+  watchdog.Stop();
+}
+
+TEST(StallIsReportedWithActivityAndStack) {
+  FlutterWatchdog::StallReport last_report;
+  int report_count = 0;
+  FlutterWatchdog watchdog(
+      0.2, true, [&](const FlutterWatchdog::StallReport& report) {
+        last_report = report;
+        report_count++;
+      });
+  EXPECT_TRUE(watchdog.Start());
+  {
+    FlutterWatchdog::ScopedActivity activity("Spin");
+    Spin(500);
+  }
+  watchdog.Stop();
+  EXPECT_EQ(1, report_count);
+  EXPECT_EQ(std::string("Spin"), last_report.activity);
+  EXPECT_FALSE(last_report.native_stack.empty());
+}
+
+TEST(StaleStackSignalsAreIgnored) {
+  std::vector<std::string> native_stack;
+  FlutterWatchdog watchdog(0.2, true,
+                           [&](const FlutterWatchdog::StallReport& report) {
+                             native_stack = report.native_stack;
+                           });
+  EXPECT_TRUE(watchdog.Start());
+  // Signals delivered after their requests timed out must neither kill the
+  // process nor be taken for a later capture.
+  SendStackSignal(1);
+  SendStackSignal(12345);
+  raise(SIGUSR2);
+  Spin(500);
+  watchdog.Stop();
+  EXPECT_FALSE(native_stack.empty());
+
+  // The handler stays installed after |Stop|, and stale signals of the
+  // watchdog are not passed on.
+  int app_signal_count = g_app_signal_count;
+  SendStackSignal(1);
+  EXPECT_EQ(app_signal_count, static_cast<int>(g_app_signal_count));
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,207 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures how the job throughput of FlutterWorkerPool scales with the
+// number of workers.
+//
+// The UI isolate of each fake worker is a thread which runs CPU-bound jobs
+// and hands the replies back to the main thread, which stands in for the
+// platform thread and owns the pool.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/flutter_worker_pool.h"
+#include "../tizen_log.h"
+#include "fake/fake_flutter_tizen.h"
+
+namespace {
+
+constexpr char kChannel[] = "tizen/worker";
+
+// The number of jobs run for each worker count.
+constexpr size_t kJobCount = 1000;
+
+// The number of hash rounds per job, which takes about a millisecond.
+constexpr uint64_t kRoundsPerJob = 100000;
+
+// Discards the logs of the pool.
+class NullLogSink : public TizenLogSink {
+ public:
+  void Write(log_priority priority, const char* tag,
+             const char* message) override {}
+};
+
+// A job which has been run and whose reply is waiting for the main thread.
+struct Completion {
+  FakeSentMessage job;
+  std::vector<uint8_t> reply;
+};
+
+// The replies handed to the main thread.
+class Completions {
+ public:
+  void Push(Completion completion) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    completions_.push_back(std::move(completion));
+    cv_.notify_one();
+  }
+
+  // Waits for at least one completion and takes all of them.
+  std::deque<Completion> TakeAll() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return !completions_.empty(); });
+    std::deque<Completion> completions;
+    completions.swap(completions_);
+    return completions;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Completion> completions_;
+};
+
+// Runs the jobs sent to one worker on its own thread.
+class FakeIsolate {
+ public:
+  explicit FakeIsolate(Completions& completions)
+      : thread_([this, &completions]() { RunLoop(completions); }) {}
+
+  ~FakeIsolate() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      is_quitting_ = true;
+      cv_.notify_one();
+    }
+    thread_.join();
+  }
+
+  void Post(FakeSentMessage job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(std::move(job));
+    cv_.notify_one();
+  }
+
+ private:
+  void RunLoop(Completions& completions) {
+    while (true) {
+      FakeSentMessage job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return is_quitting_ || !jobs_.empty(); });
+        if (is_quitting_) {
+          return;
+        }
+        job = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      uint64_t hash = 14695981039346656037ull;
+      for (uint64_t round = 0; round < kRoundsPerJob; round++) {
+        for (uint8_t byte : job.message) {
+          hash = (hash ^ byte) * 1099511628211ull;
+        }
+      }
+      std::vector<uint8_t> reply(sizeof(hash));
+      memcpy(reply.data(), &hash, sizeof(hash));
+      completions.Push({std::move(job), std::move(reply)});
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<FakeSentMessage> jobs_;
+  bool is_quitting_ = false;
+  std::thread thread_;
+};
+
+// Runs |kJobCount| jobs on |worker_count| workers and returns the number of
+// jobs completed per second.
+double Run(size_t worker_count) {
+  FlutterWorkerPool pool(kChannel);
+  pool.Spawn(std::make_shared<FlutterEngineArguments>(), worker_count,
+             "worker");
+  std::vector<FlutterDesktopMessengerRef> messengers;
+  for (FlutterEngine* engine : pool.GetEngines()) {
+    messengers.push_back(engine->GetMessenger());
+  }
+  Completions completions;
+  std::vector<std::unique_ptr<FakeIsolate>> isolates;
+  for (size_t i = 0; i < worker_count; i++) {
+    isolates.push_back(std::make_unique<FakeIsolate>(completions));
+  }
+
+  // Hands the jobs sent by the pool over to the isolates.
+  auto post_jobs = [&]() {
+    for (size_t i = 0; i < worker_count; i++) {
+      auto& sent_messages = messengers[i]->sent_messages;
+      while (!sent_messages.empty()) {
+        isolates[i]->Post(std::move(sent_messages.front()));
+        sent_messages.pop_front();
+      }
+    }
+  };
+
+  size_t completed = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kJobCount; i++) {
+    std::vector<uint8_t> message(8, static_cast<uint8_t>(i));
+    pool.Submit(std::move(message),
+                [&completed](const uint8_t* result, size_t result_size) {
+                  if (result) {
+                    completed++;
+                  }
+                });
+  }
+  for (FlutterDesktopMessengerRef messenger : messengers) {
+    FakeFlutterTizen::SendToCallback(messenger, kChannel, {});
+  }
+  post_jobs();
+  while (completed < kJobCount) {
+    for (Completion& completion : completions.TakeAll()) {
+      completion.job.reply(completion.reply.data(), completion.reply.size(),
+                           completion.job.user_data);
+    }
+    post_jobs();
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  isolates.clear();
+  pool.Shutdown();
+  return completed / seconds;
+}
+
+}  // namespace
+
+int main() {
+  TizenLog::SetSink(std::make_unique<NullLogSink>());
+  unsigned int cores = std::thread::hardware_concurrency();
+  printf("Worker pool throughput (%u cores):\n", cores);
+  double baseline = 0.0;
+  for (size_t worker_count : {1, 2, 4, 8}) {
+    if (worker_count > 1 && worker_count > cores) {
+      printf("  %zu worker(s) skipped, which would share cores\n",
+             worker_count);
+      continue;
+    }
+    double jobs_per_second = Run(worker_count);
+    if (worker_count == 1) {
+      baseline = jobs_per_second;
+    }
+    printf("  %zu worker(s) %10.0f jobs/s %6.2fx\n", worker_count,
+           jobs_per_second, jobs_per_second / baseline);
+  }
+  TizenLog::SetSink(nullptr);
+  return 0;
+}
@@ -0,0 +1,239 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../include/flutter_worker_pool.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fake/fake_flutter_tizen.h"
+#include "testing.h"
+
+namespace {
+
+constexpr char kChannel[] = "tizen/worker";
+
+// The results passed to the result callbacks, in order. A failed job is
+// recorded as "failed".
+class Results {
+ public:
+  FlutterWorkerPool::ResultCallback GetCallback() {
+    return [this](const uint8_t* result, size_t result_size) {
+      values.push_back(result ? std::string(result, result + result_size)
+                              : "failed");
+    };
+  }
+
+  std::vector<std::string> values;
+};
+
+std::vector<uint8_t> ToBytes(const std::string& value) {
+  return std::vector<uint8_t>(value.begin(), value.end());
+}
+
+// Spawns |count| workers, which are not ready yet.
+size_t Spawn(FlutterWorkerPool& pool, size_t count) {
+  return pool.Spawn(std::make_shared<FlutterEngineArguments>(), count,
+                    "worker");
+}
+
+FlutterDesktopMessengerRef GetMessenger(FlutterWorkerPool& pool,
+                                        size_t index) {
+  return pool.GetEngines()[index]->GetMessenger();
+}
+
+// Sends the ready message of a worker, as its entrypoint does.
+bool MarkReady(FlutterWorkerPool& pool, size_t index) {
+  return FakeFlutterTizen::SendToCallback(GetMessenger(pool, index), kChannel,
+                                          {});
+}
+
+// The jobs sent to a worker and not replied to yet.
+std::vector<std::string> GetJobs(FlutterWorkerPool& pool, size_t index) {
+  std::vector<std::string> jobs;
+  for (const FakeSentMessage& message :
+       GetMessenger(pool, index)->sent_messages) {
+    jobs.emplace_back(message.message.begin(), message.message.end());
+  }
+  return jobs;
+}
+
+// Replies to the oldest job sent to a worker with the job prefixed by
+// "done ".
+bool Complete(FlutterWorkerPool& pool, size_t index) {
+  FlutterDesktopMessengerRef messenger = GetMessenger(pool, index);
+  if (messenger->sent_messages.empty()) {
+    return false;
+  }
+  FakeSentMessage message = messenger->sent_messages.front();
+  messenger->sent_messages.pop_front();
+  std::vector<uint8_t> reply = ToBytes("done ");
+  reply.insert(reply.end(), message.message.begin(), message.message.end());
+  message.reply(reply.data(), reply.size(), message.user_data);
+  return true;
+}
+
+}  // namespace
+
+TEST(JobsWaitForReadyWorker) {
+  FakeFlutterTizen::Reset();
+  Results results;
+  FlutterWorkerPool pool;
+  EXPECT_EQ(2u, Spawn(pool, 2));
+  pool.Submit(ToBytes("a"), results.GetCallback());
+  EXPECT_EQ(1u, pool.GetQueuedCount());
+
+  EXPECT_TRUE(MarkReady(pool, 1));
+  EXPECT_EQ(0u, pool.GetQueuedCount());
+  EXPECT_EQ(1u, GetMessenger(pool, 1)->responses.size());
+  std::vector<std::string> expected = {"a"};
+  EXPECT_TRUE(expected == GetJobs(pool, 1));
+  EXPECT_TRUE(GetJobs(pool, 0).empty());
+
+  EXPECT_TRUE(Complete(pool, 1));
+  expected = {"done a"};
+  EXPECT_TRUE(expected == results.values);
+  EXPECT_EQ(1u, pool.GetStats().completed);
+}
+
+TEST(JobsGoToTheLeastBusyWorker) {
+  FakeFlutterTizen::Reset();
+  Results results;
+  FlutterWorkerPool pool(kChannel, 2);
+  Spawn(pool, 2);
+  MarkReady(pool, 0);
+  MarkReady(pool, 1);
+  for (const char* job : {"a", "b", "c", "d", "e"}) {
+    pool.Submit(ToBytes(job), results.GetCallback());
+  }
+  std::vector<std::string> expected = {"a", "c"};
+  EXPECT_TRUE(expected == GetJobs(pool, 0));
+  expected = {"b", "d"};
+  EXPECT_TRUE(expected == GetJobs(pool, 1));
+  // Both workers have as many jobs as they may.
+  EXPECT_EQ(1u, pool.GetQueuedCount());
+
+  // The queued job goes to the first worker with a free slot.
+  EXPECT_TRUE(Complete(pool, 1));
+  expected = {"d", "e"};
+  EXPECT_TRUE(expected == GetJobs(pool, 1));
+  EXPECT_EQ(0u, pool.GetQueuedCount());
+}
+
+TEST(JobsAreDispatchedInSubmitOrder) {
+  FakeFlutterTizen::Reset();
+  Results results;
+  FlutterWorkerPool pool;
+  Spawn(pool, 1);
+  MarkReady(pool, 0);
+  for (const char* job : {"a", "b", "c"}) {
+    pool.Submit(ToBytes(job), results.GetCallback());
+  }
+  std::vector<std::string> sent;
+  while (!GetJobs(pool, 0).empty()) {
+    sent.push_back(GetJobs(pool, 0).front());
+    Complete(pool, 0);
+  }
+  std::vector<std::string> expected = {"a", "b", "c"};
+  EXPECT_TRUE(expected == sent);
+  expected = {"done a", "done b", "done c"};
+  EXPECT_TRUE(expected == results.values);
+}
+
+TEST(NextJobIsSentBeforeResultIsHandled) {
+  FakeFlutterTizen::Reset();
+  std::vector<std::string> jobs_seen;
+  FlutterWorkerPool pool;
+  Spawn(pool, 1);
+  MarkReady(pool, 0);
+  auto callback = [&](const uint8_t* result, size_t result_size) {
+    if (result) {
+      jobs_seen = GetJobs(pool, 0);
+    }
+  };
+  pool.Submit(ToBytes("a"), callback);
+  pool.Submit(ToBytes("b"), callback);
+  Complete(pool, 0);
+  std::vector<std::string> expected = {"b"};
+  EXPECT_TRUE(expected == jobs_seen);
+}
+
+TEST(ResultCallbackCanSubmitJobs) {
+  FakeFlutterTizen::Reset();
+  Results results;
+  FlutterWorkerPool pool;
+  Spawn(pool, 1);
+  MarkReady(pool, 0);
+  pool.Submit(ToBytes("a"), [&](const uint8_t* result, size_t result_size) {
+    pool.Submit(ToBytes("b"), results.GetCallback());
+  });
+  Complete(pool, 0);
+  std::vector<std::string> expected = {"b"};
+  EXPECT_TRUE(expected == GetJobs(pool, 0));
+  Complete(pool, 0);
+  expected = {"done b"};
+  EXPECT_TRUE(expected == results.values);
+  EXPECT_EQ(2u, pool.GetStats().submitted);
+  EXPECT_EQ(2u, pool.GetStats().completed);
+}
+
+TEST(ShutdownFailsPendingJobs) {
+  FakeFlutterTizen::Reset();
+  Results results;
+  FlutterWorkerPool pool;
+  Spawn(pool, 1);
+  MarkReady(pool, 0);
+  for (const char* job : {"a", "b", "c"}) {
+    pool.Submit(ToBytes(job), results.GetCallback());
+  }
+  FakeSentMessage in_flight = GetMessenger(pool, 0)->sent_messages.front();
+
+  pool.Shutdown();
+  EXPECT_EQ(0u, pool.GetWorkerCount());
+  EXPECT_EQ(0u, pool.GetQueuedCount());
+  EXPECT_EQ(0, FakeFlutterTizen::GetLiveEngineCount());
+  std::vector<std::string> expected = {"failed", "failed", "failed"};
+  EXPECT_TRUE(expected == results.values);
+  EXPECT_EQ(3u, pool.GetStats().failed);
+
+  // A late reply of the shut down worker is ignored.
+  uint8_t reply = 0;
+  in_flight.reply(&reply, 1, in_flight.user_data);
+  EXPECT_EQ(3u, results.values.size());
+  EXPECT_EQ(0u, pool.GetStats().completed);
+
+  // Jobs submitted afterwards wait for new workers.
+  pool.Submit(ToBytes("d"), results.GetCallback());
+  EXPECT_EQ(1u, pool.GetQueuedCount());
+}
+
+TEST(DestructorFailsPendingJobs) {
+  FakeFlutterTizen::Reset();
+  Results results;
+  {
+    FlutterWorkerPool pool;
+    Spawn(pool, 1);
+    pool.Submit(ToBytes("a"), results.GetCallback());
+  }
+  std::vector<std::string> expected = {"failed"};
+  EXPECT_TRUE(expected == results.values);
+  EXPECT_EQ(0, FakeFlutterTizen::GetLiveEngineCount());
+}
+
+TEST(SpawnStopsAtFirstFailure) {
+  FakeFlutterTizen::Reset();
+  FlutterWorkerPool pool;
+  FakeFlutterTizen::SetEngineCreateFails(true);
+  EXPECT_EQ(0u, Spawn(pool, 2));
+  FakeFlutterTizen::SetEngineCreateFails(false);
+  EXPECT_EQ(0u, pool.GetWorkerCount());
+
+  EXPECT_EQ(1u, Spawn(pool, 1));
+  EXPECT_EQ(1u, pool.GetWorkerCount());
+}
+
+int main() {
+  return RunAllTests();
+}
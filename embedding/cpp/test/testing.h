@@ -0,0 +1,65 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A minimal test harness, so the tests need nothing but a host compiler.
+
+#ifndef FLUTTER_TIZEN_EMBEDDING_CPP_TEST_TESTING_H_
+#define FLUTTER_TIZEN_EMBEDDING_CPP_TEST_TESTING_H_
+
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+struct TestCase {
+  const char* name;
+  std::function<void()> body;
+};
+
+// The tests registered by |TEST|.
+inline std::vector<TestCase>& GetTestCases() {
+  static std::vector<TestCase> test_cases;
+  return test_cases;
+}
+
+// The number of failed expectations.
+inline int& GetFailureCount() {
+  static int failure_count = 0;
+  return failure_count;
+}
+
+struct TestRegistration {
+  TestRegistration(const char* name, std::function<void()> body) {
+    GetTestCases().push_back({name, std::move(body)});
+  }
+};
+
+#define TEST(name)                                          \
+  static void name();                                       \
+  static TestRegistration name##_registration(#name, name); \
+  static void name()
+
+#define EXPECT_TRUE(condition)                                        \
+  do {                                                                \
+    if (!(condition)) {                                               \
+      fprintf(stderr, "%s:%d: Expected: %s\n", __FILE__, __LINE__,    \
+              #condition);                                            \
+      GetFailureCount()++;                                            \
+    }                                                                 \
+  } while (0)
+
+#define EXPECT_FALSE(condition) EXPECT_TRUE(!(condition))
+#define EXPECT_EQ(expected, actual) EXPECT_TRUE((expected) == (actual))
+
+// Runs all registered tests and returns the exit code of the test binary.
+inline int RunAllTests() {
+  for (const TestCase& test_case : GetTestCases()) {
+    int failure_count = GetFailureCount();
+    test_case.body();
+    bool passed = GetFailureCount() == failure_count;
+    printf("[%s] %s\n", passed ? "  OK  " : " FAIL ", test_case.name);
+  }
+  return GetFailureCount() == 0 ? 0 : 1;
+}
+
+#endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TEST_TESTING_H_ */
@@ -0,0 +1,222 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "../tizen_log.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+// How long to wait for the background thread before failing.
+constexpr std::chrono::seconds kTimeout(10);
+
+// The number of messages which fit in the queue of a thread.
+constexpr int kQueueCapacity = 64;
+
+// Records the messages written by the logger, and can hold up the
+// background thread in |Write| until released.
+class TestLogSink : public TizenLogSink {
+ public:
+  struct Record {
+    log_priority priority;
+    std::string message;
+    std::thread::id thread_id;
+  };
+
+  void Write(log_priority priority, const char* tag,
+             const char* message) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    records_.push_back({priority, message, std::this_thread::get_id()});
+    cv_.notify_all();
+    cv_.wait(lock, [this]() { return !is_blocked_; });
+  }
+
+  // Makes |Write| wait until |Unblock| is called.
+  void Block() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_blocked_ = true;
+  }
+
+  void Unblock() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_blocked_ = false;
+    cv_.notify_all();
+  }
+
+  // Waits until at least |count| messages have been written.
+  bool WaitForRecords(size_t count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, kTimeout,
+                        [this, count]() { return records_.size() >= count; });
+  }
+
+  std::vector<Record> GetRecords() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return records_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<Record> records_;
+  bool is_blocked_ = false;
+};
+
+// Installs a |TestLogSink| for the duration of a test.
+class SinkScope {
+ public:
+  SinkScope() {
+    auto sink = std::make_unique<TestLogSink>();
+    sink_ = sink.get();
+    TizenLog::SetSink(std::move(sink));
+  }
+
+  ~SinkScope() {
+    sink_->Unblock();
+    TizenLog::SetSink(nullptr);
+  }
+
+  TestLogSink& sink() { return *sink_; }
+
+ private:
+  TestLogSink* sink_;
+};
+
+// Whether |records| holds "<prefix>0" to "<prefix><count - 1>" in order,
+// possibly interleaved with other messages.
+bool HasInOrder(const std::vector<TestLogSink::Record>& records,
+                const std::string& prefix, int count) {
+  int next = 0;
+  for (const TestLogSink::Record& record : records) {
+    if (record.message.rfind(prefix, 0) != 0) {
+      continue;
+    }
+    if (record.message != prefix + std::to_string(next)) {
+      return false;
+    }
+    next++;
+  }
+  return next == count;
+}
+
+}  // namespace
+
+TEST(MessagesAreWrittenWithoutFlush) {
+  SinkScope scope;
+  // Each message wakes up the background thread, which has no timeout to
+  // fall back on.
+  for (int i = 0; i < 100; i++) {
+    TizenLog::Info("message %d", i);
+    EXPECT_TRUE(scope.sink().WaitForRecords(i + 1));
+  }
+  std::vector<TestLogSink::Record> records = scope.sink().GetRecords();
+  EXPECT_TRUE(HasInOrder(records, "message ", 100));
+  if (!records.empty()) {
+    EXPECT_TRUE(records[0].priority == DLOG_INFO);
+    EXPECT_TRUE(records[0].thread_id != std::this_thread::get_id());
+  }
+}
+
+TEST(ErrorsAreWrittenSynchronously) {
+  SinkScope scope;
+  TizenLog::Debug("queued");
+  TizenLog::Error("error");
+  // The error is written before Error returns, after the message queued
+  // before it.
+  std::vector<TestLogSink::Record> records = scope.sink().GetRecords();
+  EXPECT_EQ(2u, records.size());
+  if (records.size() == 2) {
+    EXPECT_EQ("queued", records[0].message);
+    EXPECT_EQ("error", records[1].message);
+    EXPECT_TRUE(records[1].priority == DLOG_ERROR);
+    EXPECT_TRUE(records[1].thread_id == std::this_thread::get_id());
+  }
+}
+
+TEST(LongMessagesKeepTheirOrder) {
+  SinkScope scope;
+  std::string long_message(1000, 'x');
+  TizenLog::Info("message 0");
+  TizenLog::Info("%s", long_message.c_str());
+  TizenLog::Info("message 1");
+  TizenLog::Flush();
+  std::vector<TestLogSink::Record> records = scope.sink().GetRecords();
+  EXPECT_EQ(3u, records.size());
+  if (records.size() == 3) {
+    EXPECT_EQ(long_message, records[1].message);
+  }
+  EXPECT_TRUE(HasInOrder(records, "message ", 2));
+}
+
+TEST(FullQueueBlocksInsteadOfDropping) {
+  SinkScope scope;
+  scope.sink().Block();
+  constexpr int kMessageCount = kQueueCapacity * 3;
+  std::atomic<int> logged_count{0};
+  std::thread producer([&]() {
+    for (int i = 0; i < kMessageCount; i++) {
+      TizenLog::Info("message %d", i);
+      logged_count++;
+    }
+  });
+
+  // The background thread takes the first message and is held up writing
+  // it, while it still occupies its slot. The rest of the queue fills up
+  // without blocking the producer.
+  EXPECT_TRUE(scope.sink().WaitForRecords(1));
+  auto deadline = std::chrono::steady_clock::now() + kTimeout;
+  while (logged_count < kQueueCapacity &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(kQueueCapacity, logged_count.load());
+  // The next message is written synchronously once the queue is drained.
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(kQueueCapacity, logged_count.load());
+
+  scope.sink().Unblock();
+  producer.join();
+  TizenLog::Flush();
+  std::vector<TestLogSink::Record> records = scope.sink().GetRecords();
+  EXPECT_EQ(static_cast<size_t>(kMessageCount), records.size());
+  EXPECT_TRUE(HasInOrder(records, "message ", kMessageCount));
+}
+
+TEST(ThreadsKeepTheirOwnOrder) {
+  SinkScope scope;
+  constexpr int kThreadCount = 4;
+  constexpr int kMessageCount = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreadCount; t++) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < kMessageCount; i++) {
+        TizenLog::Debug("thread %d: %d", t, i);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  TizenLog::Flush();
+  std::vector<TestLogSink::Record> records = scope.sink().GetRecords();
+  EXPECT_EQ(static_cast<size_t>(kThreadCount * kMessageCount),
+            records.size());
+  for (int t = 0; t < kThreadCount; t++) {
+    EXPECT_TRUE(HasInOrder(records, "thread " + std::to_string(t) + ": ",
+                           kMessageCount));
+  }
+}
+
+int main() {
+  return RunAllTests();
+}
@@ -0,0 +1,199 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tizen_log.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Each thread which logs has a queue of 64 records of 512 bytes each, about
+// 32 KiB, which is freed once the thread has exited and its queue has been
+// drained.
+constexpr size_t kQueueCapacity = 64;
+constexpr size_t kMaxMessageLength = 512;
+
+struct LogRecord {
+  log_priority priority;
+  const char *tag;
+  char message[kMaxMessageLength];
+};
+
+// A single-producer single-consumer ring buffer owned by a logging thread.
+struct LogQueue {
+  LogRecord records[kQueueCapacity];
+  // The next slot to be written by the producer.
+  std::atomic<size_t> head{0};
+  // The next slot to be read by the consumer.
+  std::atomic<size_t> tail{0};
+};
+
+class LogBackend {
+ public:
+  static LogBackend &Instance() {
+    // Intentionally leaked so that it outlives thread-local queues and other
+    // static objects which may log during exit.
+    static LogBackend *instance = new LogBackend();
+    return *instance;
+  }
+
+  void Print(log_priority priority, const char *format, va_list args) {
+    if (priority < DLOG_ERROR) {
+      LogQueue &queue = GetQueue();
+      size_t head = queue.head.load(std::memory_order_relaxed);
+      size_t tail = queue.tail.load(std::memory_order_acquire);
+      if (head - tail < kQueueCapacity) {
+        LogRecord &record = queue.records[head % kQueueCapacity];
+        va_list args_copy;
+        va_copy(args_copy, args);
+        int length = vsnprintf(record.message, kMaxMessageLength, format,
+                               args_copy);
+        va_end(args_copy);
+        if (length >= 0 && static_cast<size_t>(length) < kMaxMessageLength) {
+          record.priority = priority;
+          record.tag = TizenLog::tag;
+          queue.head.store(head + 1, std::memory_order_release);
+          WakeUp();
+          return;
+        }
+      }
+    }
+    // Preserve ordering with the messages already queued by this thread.
+    Flush();
+    std::lock_guard<std::mutex> lock(sink_mutex_);
+    char message[4096];
+    vsnprintf(message, sizeof(message), format, args);
+    sink_->Write(priority, TizenLog::tag, message);
+  }
+
+  void SetSink(std::unique_ptr<TizenLogSink> sink) {
+    Flush();
+    std::lock_guard<std::mutex> lock(sink_mutex_);
+    sink_ = sink ? std::move(sink) : std::make_unique<TizenDlogSink>();
+  }
+
+  void Flush() {
+    std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+    Drain();
+  }
+
+ private:
+  LogBackend() : sink_(std::make_unique<TizenDlogSink>()) {
+    std::thread(&LogBackend::DrainLoop, this).detach();
+    atexit([]() { LogBackend::Instance().Flush(); });
+  }
+
+  LogQueue &GetQueue() {
+    thread_local std::shared_ptr<LogQueue> queue = [this]() {
+      auto new_queue = std::make_shared<LogQueue>();
+      std::lock_guard<std::mutex> lock(queues_mutex_);
+      queues_.push_back(new_queue);
+      return new_queue;
+    }();
+    return *queue;
+  }
+
+  // Called after a record has been queued.
+  //
+  // The sequence number is incremented before |is_sleeping_| is read, and
+  // the drain thread sets |is_sleeping_| before it reads the sequence
+  // number, so either this thread sees that the drain thread is about to
+  // sleep and notifies it under |sleep_mutex_|, or the drain thread sees
+  // the new sequence number and does not sleep. Both are sequentially
+  // consistent, which the ordering relies on.
+  void WakeUp() {
+    sequence_.fetch_add(1);
+    if (is_sleeping_.exchange(false)) {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      drain_cv_.notify_one();
+    }
+  }
+
+  void DrainLoop() {
+    while (true) {
+      uint64_t sequence = sequence_.load();
+      Flush();
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      is_sleeping_.store(true);
+      drain_cv_.wait(lock, [this, sequence]() {
+        return sequence_.load() != sequence;
+      });
+      is_sleeping_.store(false);
+    }
+  }
+
+  // Must be called with |drain_mutex_| held.
+  void Drain() {
+    std::vector<std::shared_ptr<LogQueue>> queues;
+    {
+      std::lock_guard<std::mutex> lock(queues_mutex_);
+      queues = queues_;
+    }
+    std::lock_guard<std::mutex> sink_lock(sink_mutex_);
+    for (const std::shared_ptr<LogQueue> &queue : queues) {
+      size_t tail = queue->tail.load(std::memory_order_relaxed);
+      size_t head = queue->head.load(std::memory_order_acquire);
+      for (; tail != head; tail++) {
+        const LogRecord &record = queue->records[tail % kQueueCapacity];
+        sink_->Write(record.priority, record.tag, record.message);
+        queue->tail.store(tail + 1, std::memory_order_release);
+      }
+    }
+    // Release the queues of exited threads once they have been drained.
+    std::lock_guard<std::mutex> lock(queues_mutex_);
+    for (auto it = queues_.begin(); it != queues_.end();) {
+      const std::shared_ptr<LogQueue> &queue = *it;
+      // One reference is held by |queues_| and another one by |queues|.
+      if (queue.use_count() == 2 &&
+          queue->tail.load(std::memory_order_relaxed) ==
+              queue->head.load(std::memory_order_acquire)) {
+        it = queues_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  std::unique_ptr<TizenLogSink> sink_;
+  std::mutex sink_mutex_;
+
+  std::vector<std::shared_ptr<LogQueue>> queues_;
+  std::mutex queues_mutex_;
+
+  std::mutex drain_mutex_;
+  std::mutex sleep_mutex_;
+  std::condition_variable drain_cv_;
+  // The number of records queued so far by all threads.
+  std::atomic<uint64_t> sequence_{0};
+  // Whether the drain thread may be waiting on |drain_cv_|.
+  std::atomic<bool> is_sleeping_{false};
+};
+
+}  // namespace
+
+void TizenFileLogSink::Write(log_priority priority, const char *tag,
+                             const char *message) {
+  static constexpr char kPriorityLetters[] = "??VDIWEF";
+  char letter = priority >= 0 && priority < sizeof(kPriorityLetters) - 1
+                    ? kPriorityLetters[priority]
+                    : '?';
+  fprintf(file_, "%c/%s: %s\n", letter, tag, message);
+  fflush(file_);
+}
+
+void TizenLog::SetSink(std::unique_ptr<TizenLogSink> sink) {
+  LogBackend::Instance().SetSink(std::move(sink));
+}
+
+void TizenLog::Flush() { LogBackend::Instance().Flush(); }
+
+void TizenLog::Print(log_priority priority, const char *format,
+                     va_list args) {
+  LogBackend::Instance().Print(priority, format, args);
+}
@@ -8,42 +8,109 @@
 #include <dlog.h>
 
 #include <cstdarg>
+#include <cstdio>
+#include <memory>
 
+// Log calls below this priority are compiled out.
+#ifndef TIZEN_LOG_MIN_PRIORITY
+#define TIZEN_LOG_MIN_PRIORITY DLOG_DEBUG
+#endif
+
+// The destination of log messages.
+//
+// |Write| is called on the background logging thread, or on the calling
+// thread for messages which are written synchronously.
+class TizenLogSink {
+ public:
+  virtual ~TizenLogSink() = default;
+
+  virtual void Write(log_priority priority, const char *tag,
+                     const char *message) = 0;
+};
+
+// Writes log messages to dlog. This is the default sink.
+class TizenDlogSink : public TizenLogSink {
+ public:
+  void Write(log_priority priority, const char *tag,
+             const char *message) override {
+    dlog_print(priority, tag, "%s", message);
+  }
+};
+
+// Writes log messages to a file, e.g. stderr when running off-device.
+class TizenFileLogSink : public TizenLogSink {
+ public:
+  explicit TizenFileLogSink(FILE *file) : file_(file) {}
+
+  void Write(log_priority priority, const char *tag,
+             const char *message) override;
+
+ private:
+  FILE *file_;
+};
+
+// Logs messages without blocking the calling thread.
+//
+// Messages are formatted on the calling thread into a per-thread lock-free
+// queue and written to the sink by a background thread, which sleeps until
+// a message is queued. Error messages, messages which do not fit in a queue
+// slot, and messages logged while the queue is full are written
+// synchronously so that they are never lost. Each queue holds 64 messages
+// of up to 511 characters, which takes about 32 KiB for each thread which
+// logs.
 class TizenLog {
  public:
   static inline const char *tag = "ConsoleMessage";
 
   static void Debug(const char *format, ...) {
-    va_list args;
-    va_start(args, format);
-    dlog_vprint(DLOG_DEBUG, tag, format, args);
-    va_end(args);
+    if constexpr (TIZEN_LOG_MIN_PRIORITY <= DLOG_DEBUG) {
+      va_list args;
+      va_start(args, format);
+      Print(DLOG_DEBUG, format, args);
+      va_end(args);
+    }
   }
 
   static void Info(const char *format, ...) {
-    va_list args;
-    va_start(args, format);
-    dlog_vprint(DLOG_INFO, tag, format, args);
-    va_end(args);
+    if constexpr (TIZEN_LOG_MIN_PRIORITY <= DLOG_INFO) {
+      va_list args;
+      va_start(args, format);
+      Print(DLOG_INFO, format, args);
+      va_end(args);
+    }
   }
 
   static void Warn(const char *format, ...) {
-    va_list args;
-    va_start(args, format);
-    dlog_vprint(DLOG_WARN, tag, format, args);
-    va_end(args);
+    if constexpr (TIZEN_LOG_MIN_PRIORITY <= DLOG_WARN) {
+      va_list args;
+      va_start(args, format);
+      Print(DLOG_WARN, format, args);
+      va_end(args);
+    }
   }
 
   static void Error(const char *format, ...) {
-    va_list args;
-    va_start(args, format);
-    dlog_vprint(DLOG_ERROR, tag, format, args);
-    va_end(args);
+    if constexpr (TIZEN_LOG_MIN_PRIORITY <= DLOG_ERROR) {
+      va_list args;
+      va_start(args, format);
+      Print(DLOG_ERROR, format, args);
+      va_end(args);
+    }
   }
 
+  // Replaces the sink. Pending messages are written to the old sink first.
+  //
+  // Passing nullptr restores the default dlog sink.
+  static void SetSink(std::unique_ptr<TizenLogSink> sink);
+
+  // Writes all pending messages to the sink.
+  static void Flush();
+
  private:
   explicit TizenLog() {}
   virtual ~TizenLog() {}
+
+  static void Print(log_priority priority, const char *format, va_list args);
 };
 
 #endif /* FLUTTER_TIZEN_EMBEDDING_CPP_TIZEN_LOG_H_ */
@@ -2,8 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:crypto/crypto.dart';
 import 'package:flutter_tools/src/base/common.dart';
 import 'package:flutter_tools/src/base/file_system.dart';
+import 'package:flutter_tools/src/base/logger.dart';
 import 'package:flutter_tools/src/base/process.dart';
 import 'package:flutter_tools/src/build_info.dart';
 import 'package:flutter_tools/src/build_system/build_system.dart';
@@ -17,6 +22,9 @@ import '../tizen_sdk.dart';
 import '../tizen_tpk.dart';
 import 'utils.dart';
 
+/// The directory in `embedding/cpp` where build results are cached.
+const kCacheDirectory = '.build_cache';
+
 class NativeEmbedding extends Target {
   NativeEmbedding(this.buildInfo);
 
@@ -86,6 +94,10 @@ class NativeEmbedding extends Target {
         .whereType<File>()
         .forEach(inputs.add);
 
+    // The manifest only affects the choice of the rootstrap, which is part of
+    // the build variant.
+    final String inputsHash = _computeHash(inputs);
+
     assert(tizenSdk != null);
     String? apiVersion;
     if (tizenProject.manifestFile.existsSync()) {
@@ -99,36 +111,162 @@ class NativeEmbedding extends Target {
       arch: buildInfo.targetArch,
     );
 
+    // The result of each build variant is cached in the embedding directory,
+    // which is shared by all projects. The objects of the last build are kept
+    // as well, so that only changed sources are recompiled.
+    final String variant = <String>[
+      buildConfig,
+      buildInfo.targetArch,
+      buildInfo.deviceProfile,
+      rootstrap.id,
+    ].join('-');
+    final Directory cacheDir = embeddingDir.childDirectory(kCacheDirectory);
+    final Directory variantDir = cacheDir.childDirectory(variant);
+    final File cachedLib = variantDir.childFile('libembedding_cpp.a');
+    final File hashFile = variantDir.childFile('inputs.md5');
+    final Logger logger = environment.logger;
+
+    // All variants of a build configuration are built in the same directory
+    // of the embedding, so builds of the same configuration, possibly of
+    // other projects, must not run at the same time.
+    final RandomAccessFile lock = await _lockBuildConfig(cacheDir, buildConfig, logger);
+    try {
+      if (cachedLib.existsSync() &&
+          hashFile.existsSync() &&
+          hashFile.readAsStringSync() == inputsHash) {
+        logger.printTrace('C++ embedding ($variant): cache hit, no sources changed.');
+      } else {
+        await _buildVariant(
+          embeddingDir,
+          variantDir,
+          variant: variant,
+          buildConfig: buildConfig,
+          rootstrap: rootstrap,
+          logger: logger,
+        );
+        hashFile.writeAsStringSync(inputsHash);
+      }
+      outputs.add(cachedLib.copySync(outputDir.childFile(cachedLib.basename).path));
+    } finally {
+      lock.unlockSync();
+      lock.closeSync();
+    }
+
+    depfileService.writeToFile(
+      Depfile(inputs, outputs),
+      environment.buildDir.childFile('tizen_embedding.d'),
+    );
+  }
+
+  /// Builds the library of [variant] into [variantDir].
+  ///
+  /// The objects of the last build of [variant] are moved into the build
+  /// directory, and moved back afterwards even if the build fails.
+  Future<void> _buildVariant(
+    Directory embeddingDir,
+    Directory variantDir, {
+    required String variant,
+    required String buildConfig,
+    required Rootstrap rootstrap,
+    required Logger logger,
+  }) async {
     final Directory buildDir = embeddingDir.childDirectory(buildConfig);
     if (buildDir.existsSync()) {
       buildDir.deleteSync(recursive: true);
     }
-    final RunResult result = await tizenSdk!.buildNative(
-      embeddingDir.path,
-      configuration: buildConfig,
-      arch: getTizenCliArch(buildInfo.targetArch),
-      predefines: <String>[
-        '${buildInfo.deviceProfile.toUpperCase()}_PROFILE',
-      ],
-      extraOptions: <String>['-fPIC'],
-      rootstrap: rootstrap.id,
-    );
-    if (result.exitCode != 0) {
-      throwToolExit('Failed to build C++ embedding:\n$result');
+    final Directory objectsDir = variantDir.childDirectory(buildConfig);
+    if (objectsDir.existsSync()) {
+      objectsDir.renameSync(buildDir.path);
     }
+    try {
+      final Map<String, DateTime> previousObjects = _listObjects(buildDir);
 
-    final File outputLib = buildDir.childFile('libembedding_cpp.a');
-    if (!outputLib.existsSync()) {
-      throwToolExit(
-        'Build succeeded but the file ${outputLib.path} is not found:\n'
-        '${result.stdout}',
+      final RunResult result = await tizenSdk!.buildNative(
+        embeddingDir.path,
+        configuration: buildConfig,
+        arch: getTizenCliArch(buildInfo.targetArch),
+        predefines: <String>[
+          '${buildInfo.deviceProfile.toUpperCase()}_PROFILE',
+        ],
+        extraOptions: <String>['-fPIC'],
+        rootstrap: rootstrap.id,
       );
+      if (result.exitCode != 0) {
+        throwToolExit('Failed to build C++ embedding:\n$result');
+      }
+
+      final File outputLib = buildDir.childFile('libembedding_cpp.a');
+      if (!outputLib.existsSync()) {
+        throwToolExit(
+          'Build succeeded but the file ${outputLib.path} is not found:\n'
+          '${result.stdout}',
+        );
+      }
+
+      final Map<String, DateTime> objects = _listObjects(buildDir);
+      final int reused =
+          objects.keys.where((String path) => objects[path] == previousObjects[path]).length;
+      final String hitRate =
+          objects.isEmpty ? '0.0' : (reused * 100 / objects.length).toStringAsFixed(1);
+      logger.printTrace(
+        'C++ embedding ($variant): reused $reused of ${objects.length} objects ($hitRate%).',
+      );
+
+      variantDir.createSync(recursive: true);
+      outputLib.copySync(variantDir.childFile(outputLib.basename).path);
+    } finally {
+      if (buildDir.existsSync()) {
+        variantDir.createSync(recursive: true);
+        buildDir.renameSync(objectsDir.path);
+      }
     }
-    outputs.add(outputLib.copySync(outputDir.childFile(outputLib.basename).path));
+  }
 
-    depfileService.writeToFile(
-      Depfile(inputs, outputs),
-      environment.buildDir.childFile('tizen_embedding.d'),
-    );
+  /// Takes the lock of [buildConfig] in [cacheDir], waiting for other builds
+  /// of the same configuration to release it.
+  Future<RandomAccessFile> _lockBuildConfig(
+    Directory cacheDir,
+    String buildConfig,
+    Logger logger,
+  ) async {
+    final File lockFile = cacheDir.childFile('$buildConfig.lock')..createSync(recursive: true);
+    final RandomAccessFile lock = lockFile.openSync(mode: FileMode.write);
+    var printed = false;
+    while (true) {
+      try {
+        lock.lockSync();
+        return lock;
+      } on FileSystemException {
+        if (!printed) {
+          logger.printStatus('Waiting for another build of the C++ embedding to finish...');
+          printed = true;
+        }
+        await Future<void>.delayed(const Duration(milliseconds: 50));
+      }
+    }
+  }
+
+  /// Returns the MD5 hash of the paths and contents of [files].
+  String _computeHash(List<File> files) {
+    final List<File> sortedFiles = files.toList()
+      ..sort((File a, File b) => a.path.compareTo(b.path));
+    final builder = BytesBuilder(copy: false);
+    for (final file in sortedFiles) {
+      builder.add(utf8.encode(file.path));
+      builder.add(file.readAsBytesSync());
+    }
+    return md5.convert(builder.takeBytes()).toString();
+  }
+
+  /// Returns the modification time of each object file in [buildDir].
+  Map<String, DateTime> _listObjects(Directory buildDir) {
+    if (!buildDir.existsSync()) {
+      return <String, DateTime>{};
+    }
+    return <String, DateTime>{
+      for (final File file in buildDir.listSync(recursive: true).whereType<File>())
+        if (file.path.endsWith('.o'))
+          file.fileSystem.path.relative(file.path, from: buildDir.path): file.lastModifiedSync(),
+    };
   }
 }
@@ -541,6 +541,15 @@ void RegisterPlugins(flutter::PluginRegistry *registry) {
 {{/cppPlugins}}
 }
 
+// Calls |register_plugin| with the name and the registration function of
+// each Flutter plugin, e.g. to register plugins after startup.
+template <typename Function>
+void ForEachPlugin(Function register_plugin) {
+{{#cppPlugins}}
+  register_plugin("{{pluginClass}}", {{pluginClass}}RegisterWithRegistrar);
+{{/cppPlugins}}
+}
+
 #endif  // GENERATED_PLUGIN_REGISTRANT_
 ''';
 
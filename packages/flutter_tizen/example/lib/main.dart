@@ -5,10 +5,15 @@
 // ignore_for_file: public_member_api_docs
 
 import 'package:flutter/material.dart';
+import 'package:flutter_tizen/benchmark.dart';
 import 'package:flutter_tizen/flutter_tizen.dart';
 
 void main() => runApp(const MyApp());
 
+// Run by FlutterChannelBenchmark in the C++ embedding.
+@pragma('vm:entry-point')
+void channelBenchmarkMain() => runChannelBenchmarkEcho();
+
 class MyApp extends StatefulWidget {
   const MyApp({super.key});
 
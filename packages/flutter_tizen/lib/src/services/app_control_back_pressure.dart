@@ -0,0 +1,22 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/services.dart';
+
+/// Makes the app control coalescer of the C++ embedding wait for the UI
+/// isolate before delivering more app controls.
+///
+/// The coalescer sends an empty message on [channel] after each delivery,
+/// and holds back and merges the app controls received until it is replied
+/// to. Since messages are handled in order, the reply is only sent once the
+/// app controls delivered before it have been handled. Has no effect unless
+/// `app_control_coalescing_window_` is set on the C++ side.
+Future<void> enableAppControlBackPressure({
+  String channel = 'tizen/app_control_ack',
+}) async {
+  final BasicMessageChannel<ByteData?> ackChannel =
+      BasicMessageChannel<ByteData?>(channel, const BinaryCodec());
+  ackChannel.setMessageHandler((ByteData? message) async => null);
+  await ackChannel.send(null);
+}
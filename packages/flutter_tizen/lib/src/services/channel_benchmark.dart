@@ -0,0 +1,38 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/services.dart';
+import 'package:flutter/widgets.dart';
+
+/// Echoes the messages sent by `FlutterChannelBenchmark` of the C++
+/// embedding.
+///
+/// Binary messages on [channel] are replied with the same bytes. `echo`
+/// method calls on `'$channel/method'` are replied with their arguments.
+void setUpChannelBenchmarkEcho({String channel = 'tizen/benchmark'}) {
+  BasicMessageChannel<ByteData?>(channel, const BinaryCodec())
+      .setMessageHandler((ByteData? message) async => message);
+  MethodChannel('$channel/method')
+      .setMethodCallHandler((MethodCall call) async {
+    if (call.method != 'echo') {
+      throw MissingPluginException();
+    }
+    return call.arguments;
+  });
+}
+
+/// Runs an entrypoint which only echoes the messages sent by
+/// `FlutterChannelBenchmark`, without drawing any frames.
+///
+/// The entrypoint must be declared in the main library of the app, so that
+/// the engine can look it up by name:
+///
+/// ```dart
+/// @pragma('vm:entry-point')
+/// void channelBenchmarkMain() => runChannelBenchmarkEcho();
+/// ```
+void runChannelBenchmarkEcho({String channel = 'tizen/benchmark'}) {
+  WidgetsFlutterBinding.ensureInitialized();
+  setUpChannelBenchmarkEcho(channel: channel);
+}
@@ -71,6 +71,79 @@ type = staticLib
     Cache: () => cache,
     TizenSdk: () => FakeTizenSdk(fileSystem),
   });
+
+  testUsingContext('Reuses cached library if sources are unchanged', () async {
+    final environment = Environment.test(
+      fileSystem.currentDirectory,
+      fileSystem: fileSystem,
+      logger: BufferLogger.test(),
+      artifacts: Artifacts.test(),
+      processManager: processManager,
+    );
+    final target = NativeEmbedding(const TizenBuildInfo(
+      BuildInfo.release,
+      targetArch: 'arm',
+      deviceProfile: 'common',
+    ));
+    await target.build(environment);
+
+    final Directory variantDir =
+        fileSystem.directory('embedding/cpp/.build_cache/Release-arm-common-rootstrap');
+    expect(variantDir.childFile('libembedding_cpp.a'), exists);
+    expect(variantDir.childDirectory('Release'), exists);
+    expect(fileSystem.directory('embedding/cpp/Release'), isNot(exists));
+
+    variantDir.childFile('libembedding_cpp.a').writeAsStringSync('cached');
+    await target.build(environment);
+
+    final File outputLib = environment.buildDir.childFile('tizen_embedding/libembedding_cpp.a');
+    expect(outputLib.readAsStringSync(), equals('cached'));
+
+    fileSystem.file('embedding/cpp/include/flutter.h').writeAsStringSync('// Modified');
+    await target.build(environment);
+
+    expect(outputLib.readAsStringSync(), isEmpty);
+  }, overrides: <Type, Generator>{
+    FileSystem: () => fileSystem,
+    ProcessManager: () => processManager,
+    Cache: () => cache,
+    TizenSdk: () => FakeTizenSdk(fileSystem),
+  });
+
+  testUsingContext('Keeps cached objects if build fails', () async {
+    final environment = Environment.test(
+      fileSystem.currentDirectory,
+      fileSystem: fileSystem,
+      logger: BufferLogger.test(),
+      artifacts: Artifacts.test(),
+      processManager: processManager,
+    );
+    final target = NativeEmbedding(const TizenBuildInfo(
+      BuildInfo.release,
+      targetArch: 'arm',
+      deviceProfile: 'common',
+    ));
+    await target.build(environment);
+
+    final Directory variantDir =
+        fileSystem.directory('embedding/cpp/.build_cache/Release-arm-common-rootstrap');
+    final File objectFile = variantDir.childFile('Release/flutter_app.o')..createSync();
+    expect(fileSystem.file('embedding/cpp/.build_cache/Release.lock'), exists);
+
+    fileSystem.file('embedding/cpp/project_def.prop').writeAsStringSync('''
+APPNAME = embedding_cpp
+type = unknown
+''');
+    await expectLater(() => target.build(environment), throwsException);
+
+    expect(objectFile, exists);
+    expect(fileSystem.directory('embedding/cpp/Release'), isNot(exists));
+  }, overrides: <Type, Generator>{
+    FileSystem: () => fileSystem,
+    ProcessManager: () => processManager,
+    Cache: () => cache,
+    TizenSdk: () => FakeTizenSdk(fileSystem),
+  });
 }
 
 void _createFakeIncludeDirs(Cache cache) {
@@ -302,6 +302,13 @@ void RegisterPlugins(flutter::PluginRegistry *registry) {
   SomeNativePluginRegisterWithRegistrar(
       registry->GetRegistrarForPlugin("SomeNativePlugin"));
 }
+
+// Calls |register_plugin| with the name and the registration function of
+// each Flutter plugin, e.g. to register plugins after startup.
+template <typename Function>
+void ForEachPlugin(Function register_plugin) {
+  register_plugin("SomeNativePlugin", SomeNativePluginRegisterWithRegistrar);
+}
 '''));
   }, overrides: <Type, Generator>{
     FileSystem: () => fileSystem,